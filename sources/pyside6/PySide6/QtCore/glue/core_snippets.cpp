@@ -3,6 +3,7 @@
 
 #include "core_snippets_p.h"
 #include "pysideqobject.h"
+#include "pyside_p.h"
 
 #include "shiboken.h"
 #ifndef Py_LIMITED_API
@@ -13,12 +14,18 @@
 
 #include <QtCore/QCoreApplication>
 #include <QtCore/QDebug>
+#include <QtCore/QHash>
 #include <QtCore/QMetaType>
+#include <QtCore/QMutex>
 #include <QtCore/QObject>
+#include <QtCore/QPointer>
 #include <QtCore/QRegularExpression>
 #include <QtCore/QStack>
+#include <QtCore/QThread>
 #include <QtCore/QVariant>
 
+#include <utility>
+
 // Helpers for QVariant conversion
 
 QMetaType QVariant_resolveMetaType(PyTypeObject *type)
@@ -138,11 +145,32 @@ void addPostRoutine(PyObject *callback)
 
 // Helpers for QObject::findChild(ren)()
 
-static bool _findChildTypeMatch(const QObject *child, PyTypeObject *desiredType)
+// Type check of the children. For wrapped Qt classes, it is done natively
+// using the QMetaObject. The Python types of the children are only determined
+// when a class defined in Python is requested.
+class FindChildTypeMatcher
 {
-    auto *pyChildType = PySide::getTypeForQObject(child);
-    return pyChildType != nullptr && PyType_IsSubtype(pyChildType, desiredType);
-}
+public:
+    explicit FindChildTypeMatcher(PyTypeObject *desiredType) : m_desiredType(desiredType)
+    {
+        if (PyObject_TypeCheck(desiredType, SbkObjectType_TypeF())
+            && !Shiboken::ObjectType::isUserType(desiredType)) {
+            m_metaObject = PySide::retrieveMetaObject(desiredType);
+        }
+    }
+
+    bool operator()(const QObject *child) const
+    {
+        if (m_metaObject != nullptr)
+            return child->metaObject()->inherits(m_metaObject);
+        auto *pyChildType = PySide::getTypeForQObject(child);
+        return pyChildType != nullptr && PyType_IsSubtype(pyChildType, m_desiredType);
+    }
+
+private:
+    PyTypeObject *m_desiredType;
+    const QMetaObject *m_metaObject = nullptr;
+};
 
 static inline bool _findChildrenComparator(const QObject *child,
                                            const QRegularExpression &name)
@@ -156,34 +184,40 @@ static inline bool _findChildrenComparator(const QObject *child,
     return name.isNull() || name == child->objectName();
 }
 
-QObject *qObjectFindChild(const QObject *parent, const QString &name,
-                          PyTypeObject *desiredType, Qt::FindChildOptions options)
+static QObject *_findChildHelper(const QObject *parent, const QString &name,
+                                 const FindChildTypeMatcher &typeMatch,
+                                 Qt::FindChildOptions options)
 {
     for (auto *child : parent->children()) {
-        if (_findChildrenComparator(child, name)
-            && _findChildTypeMatch(child, desiredType)) {
+        if (_findChildrenComparator(child, name) && typeMatch(child))
             return child;
-        }
     }
 
     if (options.testFlag(Qt::FindChildrenRecursively)) {
         for (auto *child : parent->children()) {
-            if (auto *obj = qObjectFindChild(child, name, desiredType, options))
+            if (auto *obj = _findChildHelper(child, name, typeMatch, options))
                 return obj;
         }
     }
     return nullptr;
 }
 
+QObject *qObjectFindChild(const QObject *parent, const QString &name,
+                          PyTypeObject *desiredType, Qt::FindChildOptions options)
+{
+    return _findChildHelper(parent, name, FindChildTypeMatcher(desiredType), options);
+}
+
 template<typename T> // QString/QRegularExpression
-static void _findChildrenHelper(const QObject *parent, const T& name, PyTypeObject *desiredType,
+static void _findChildrenHelper(const QObject *parent, const T& name,
+                                const FindChildTypeMatcher &typeMatch,
                                 Qt::FindChildOptions options, FindChildHandler handler)
 {
     for (auto *child : parent->children()) {
-        if (_findChildrenComparator(child, name) && _findChildTypeMatch(child, desiredType))
+        if (_findChildrenComparator(child, name) && typeMatch(child))
             handler(child);
         if (options.testFlag(Qt::FindChildrenRecursively))
-            _findChildrenHelper(child, name, desiredType, options, handler);
+            _findChildrenHelper(child, name, typeMatch, options, handler);
     }
 }
 
@@ -191,14 +225,14 @@ void qObjectFindChildren(const QObject *parent, const QString &name,
                          PyTypeObject *desiredType, Qt::FindChildOptions options,
                          FindChildHandler handler)
 {
-    _findChildrenHelper(parent, name, desiredType, options, handler);
+    _findChildrenHelper(parent, name, FindChildTypeMatcher(desiredType), options, handler);
 }
 
 void qObjectFindChildren(const QObject *parent, const QRegularExpression &pattern,
                          PyTypeObject *desiredType, Qt::FindChildOptions options,
                          FindChildHandler handler)
 {
-    _findChildrenHelper(parent, pattern, desiredType, options, handler);
+    _findChildrenHelper(parent, pattern, FindChildTypeMatcher(desiredType), options, handler);
 }
 
 //////////////////////////////////////////////////////////////////////////////
@@ -218,7 +252,188 @@ void qObjectFindChildren(const QObject *parent, const QRegularExpression &patter
 // - if the translated string is changed:
 //   - return the translation.
 
-QString qObjectTr(PyTypeObject *type, const char *sourceText, const char *disambiguation, int n)
+// Cache of the translation contexts resolved by qObjectTr() per type and
+// source text. It is invalidated by QEvent::LanguageChange, which is sent to
+// the application when translators are installed or removed, and by
+// qObjectTrInvalidateCache(), which is called when an installed translator
+// is reloaded (in which case QTranslator::load() posts the event). The types
+// are tracked by weak references, so that their entries are dropped when
+// they are deleted (dynamically created classes). The data is guarded by a
+// mutex for free-threaded Python builds; the references are released outside
+// of it.
+class TrContextCache
+{
+public:
+    // Returns whether the cache can be used, clearing it on language change.
+    bool prepare();
+    void invalidate() { m_generation.ref(); }
+
+    bool find(PyTypeObject *type, const QByteArray &key, QByteArray *context);
+    void insert(PyTypeObject *type, const QByteArray &key, const QByteArray &context);
+
+private:
+    class LanguageChangeWatcher : public QObject
+    {
+    public:
+        explicit LanguageChangeWatcher(TrContextCache *cache, QObject *parent) :
+            QObject(parent), m_cache(cache) {}
+
+        bool eventFilter(QObject *watched, QEvent *event) override
+        {
+            if (event->type() == QEvent::LanguageChange)
+                m_cache->invalidate();
+            return QObject::eventFilter(watched, event);
+        }
+
+    private:
+        TrContextCache *m_cache;
+    };
+
+    struct TypeEntry
+    {
+        PyObject *weakRef = nullptr; // Owned by the cache
+        QHash<QByteArray, QByteArray> contexts;
+    };
+
+    using Contexts = QHash<PyTypeObject *, TypeEntry>;
+
+    static PyObject *typeDeleted(PyObject *self, PyObject *weakRef);
+    static PyObject *typeDeletedCallback();
+    static void releaseContexts(const Contexts &contexts);
+
+    QMutex m_mutex;
+    QPointer<QCoreApplication> m_application; // guarded by m_mutex
+    QAtomicInt m_generation;
+    int m_cachedGeneration = 0; // guarded by m_mutex
+    Contexts m_contexts; // guarded by m_mutex
+};
+
+static TrContextCache *trContextCache()
+{
+    // Deliberately leaked, the weak references must not be released
+    // after the interpreter has been finalized.
+    static auto *result = new TrContextCache;
+    return result;
+}
+
+bool TrContextCache::prepare()
+{
+    auto *application = QCoreApplication::instance();
+    if (application == nullptr)
+        return false;
+    Contexts oldContexts;
+    {
+        QMutexLocker locker(&m_mutex);
+        bool reset = false;
+        if (m_application != application) {
+            // The event filter can only be installed from the application thread.
+            if (application->thread() != QThread::currentThread())
+                return false;
+            application->installEventFilter(new LanguageChangeWatcher(this, application));
+            m_application = application;
+            reset = true;
+        }
+        const int generation = m_generation.loadRelaxed();
+        if (generation != m_cachedGeneration) {
+            m_cachedGeneration = generation;
+            reset = true;
+        }
+        if (reset)
+            oldContexts = std::exchange(m_contexts, {});
+    }
+    releaseContexts(oldContexts);
+    return true;
+}
+
+bool TrContextCache::find(PyTypeObject *type, const QByteArray &key,
+                          QByteArray *context)
+{
+    QMutexLocker locker(&m_mutex);
+    const auto typeIt = m_contexts.constFind(type);
+    if (typeIt == m_contexts.cend())
+        return false;
+    const auto &contexts = typeIt.value().contexts;
+    const auto it = contexts.constFind(key);
+    if (it == contexts.cend())
+        return false;
+    *context = it.value();
+    return true;
+}
+
+void TrContextCache::insert(PyTypeObject *type, const QByteArray &key,
+                            const QByteArray &context)
+{
+    {
+        QMutexLocker locker(&m_mutex);
+        auto typeIt = m_contexts.find(type);
+        if (typeIt != m_contexts.end()) {
+            typeIt.value().contexts.insert(key, context);
+            return;
+        }
+    }
+
+    // Creating the reference may run the garbage collector and thus
+    // typeDeleted(), so it is done without holding the lock.
+    auto *weakRef = PyWeakref_NewRef(reinterpret_cast<PyObject *>(type),
+                                     typeDeletedCallback());
+    if (weakRef == nullptr) {
+        PyErr_Clear();
+        return;
+    }
+    {
+        QMutexLocker locker(&m_mutex);
+        auto typeIt = m_contexts.find(type);
+        if (typeIt == m_contexts.end()) {
+            m_contexts.insert(type, {weakRef, {{key, context}}});
+            return;
+        }
+        typeIt.value().contexts.insert(key, context); // Inserted by another thread
+    }
+    Py_DECREF(weakRef);
+}
+
+// Weak reference callback dropping the entry of a deleted type. References
+// taken out of the cache by prepare() are released there.
+PyObject *TrContextCache::typeDeleted(PyObject * /* self */, PyObject *weakRef)
+{
+    auto *cache = trContextCache();
+    Contexts removed;
+    {
+        QMutexLocker locker(&cache->m_mutex);
+        for (auto it = cache->m_contexts.begin(); it != cache->m_contexts.end(); ++it) {
+            if (it.value().weakRef == weakRef) {
+                removed.insert(it.key(), it.value());
+                cache->m_contexts.erase(it);
+                break;
+            }
+        }
+    }
+    releaseContexts(removed);
+    Py_RETURN_NONE;
+}
+
+PyObject *TrContextCache::typeDeletedCallback()
+{
+    static PyMethodDef method = {"_trContextCacheTypeDeleted", typeDeleted, METH_O, nullptr};
+    static PyObject *result = PyCFunction_New(&method, nullptr);
+    return result;
+}
+
+void TrContextCache::releaseContexts(const Contexts &contexts)
+{
+    for (const auto &entry : contexts)
+        Py_DECREF(entry.weakRef);
+}
+
+void qObjectTrInvalidateCache()
+{
+    trContextCache()->invalidate();
+}
+
+// Walk the MRO until a class is found for which a translation exists.
+// Returns the context that was used last.
+static QString qObjectTrByMro(PyTypeObject *type, const char *sourceText,
+                              const char *disambiguation, int n, const char **usedContext)
 {
     PyObject *mro = type->tp_mro;
     auto len = PyTuple_GET_SIZE(mro);
@@ -234,6 +449,7 @@ QString qObjectTr(PyTypeObject *type, const char *sourceText, const char *disamb
         const char *dotpos = strrchr(context, '.');
         if (dotpos != nullptr)
             context = dotpos + 1;
+        *usedContext = context;
         result = QCoreApplication::translate(context, sourceText, disambiguation, n);
         if (result != oldResult)
             break;
@@ -241,6 +457,27 @@ QString qObjectTr(PyTypeObject *type, const char *sourceText, const char *disamb
     return result;
 }
 
+QString qObjectTr(PyTypeObject *type, const char *sourceText, const char *disambiguation, int n)
+{
+    auto *cache = trContextCache();
+
+    const char *context = nullptr;
+    if (!cache->prepare())
+        return qObjectTrByMro(type, sourceText, disambiguation, n, &context);
+
+    QByteArray key(sourceText);
+    if (disambiguation != nullptr)
+        key.append('\0').append(disambiguation);
+    QByteArray cachedContext;
+    if (cache->find(type, key, &cachedContext))
+        return QCoreApplication::translate(cachedContext.constData(), sourceText, disambiguation, n);
+
+    const QString result = qObjectTrByMro(type, sourceText, disambiguation, n, &context);
+    if (context != nullptr)
+        cache->insert(type, key, QByteArray(context));
+    return result;
+}
+
 bool PyDate_ImportAndCheck(PyObject *pyIn)
 {
     if (!PyDateTimeAPI)
@@ -47,6 +47,7 @@ void qObjectFindChildren(const QObject *parent, const QRegularExpression &patter
 
 // Helpers for translation
 QString qObjectTr(PyTypeObject *type, const char *sourceText, const char *disambiguation, int n);
+void qObjectTrInvalidateCache();
 
 bool PyDate_ImportAndCheck(PyObject *pyIn);
 bool PyDateTime_ImportAndCheck(PyObject *pyIn);
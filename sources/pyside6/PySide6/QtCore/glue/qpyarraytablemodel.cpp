@@ -0,0 +1,534 @@
+// Copyright (C) 2023 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#include "qpyarraytablemodel.h"
+
+#include <pyside_numpy.h>
+#include <pysideutils.h>
+
+#include <sbkpython.h>
+#include <autodecref.h>
+#include <gilstate.h>
+
+#include <QtCore/QFloat16>
+#include <QtCore/QList>
+
+#include <algorithm>
+#include <climits>
+#include <cmath>
+#include <cstring>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+// Element types of the supported buffer formats
+using ColumnType = PySide::Numpy::BufferType;
+
+struct ArrayColumn
+{
+    Py_buffer view{};
+    PyObject *formatter = nullptr;
+    QString header;
+    ColumnType type = ColumnType::Int8;
+
+    Py_ssize_t size() const { return view.shape[0]; }
+    const char *item(Py_ssize_t row) const
+    {
+        return static_cast<const char *>(view.buf) + row * view.strides[0];
+    }
+};
+
+class QPyArrayTableModelPrivate
+{
+public:
+    Py_ssize_t sourceRow(int row) const
+    {
+        return rows.empty() ? Py_ssize_t(row) : Py_ssize_t(rows[row]);
+    }
+
+    QList<ArrayColumn> columns;
+    std::vector<int> rows; // Row permutation established by sort()
+    int rowCount = 0;
+    int sortColumn = -1;
+    Qt::SortOrder sortOrder = Qt::AscendingOrder;
+};
+
+// The data are copied since the buffer items need not be aligned.
+template <class T>
+static inline T loadItem(const char *p)
+{
+    T result;
+    std::memcpy(&result, p, sizeof(T));
+    return result;
+}
+
+static QVariant columnValue(const ArrayColumn &c, Py_ssize_t row)
+{
+    return PySide::Numpy::bufferItemToVariant(c.type, c.item(row), c.view.itemsize);
+}
+
+// Python value passed to the formatter
+static PyObject *columnPyValue(const ArrayColumn &c, Py_ssize_t row)
+{
+    const char *p = c.item(row);
+    switch (c.type) {
+    case ColumnType::Int8:
+    case ColumnType::Int16:
+    case ColumnType::Int32:
+    case ColumnType::Int64:
+        return PyLong_FromLongLong(columnValue(c, row).toLongLong());
+    case ColumnType::UInt8:
+    case ColumnType::UInt16:
+    case ColumnType::UInt32:
+    case ColumnType::UInt64:
+        return PyLong_FromUnsignedLongLong(columnValue(c, row).toULongLong());
+    case ColumnType::Half:
+    case ColumnType::Float:
+    case ColumnType::Double:
+        return PyFloat_FromDouble(columnValue(c, row).toDouble());
+    case ColumnType::Bool:
+        return PyBool_FromLong(loadItem<quint8>(p) != 0 ? 1 : 0);
+    case ColumnType::Bytes:
+        return PyBytes_FromStringAndSize(p, Py_ssize_t(qstrnlen(p, uint(c.view.itemsize))));
+    case ColumnType::Ucs4:
+        return PySide::qStringToPyUnicode(columnValue(c, row).toString());
+    }
+    Py_RETURN_NONE;
+}
+
+static QVariant formatValue(const ArrayColumn &c, Py_ssize_t row)
+{
+    Shiboken::GilState state;
+    Shiboken::AutoDecRef value(columnPyValue(c, row));
+    Shiboken::AutoDecRef result(value.isNull() ? nullptr
+        : PyObject_CallFunctionObjArgs(c.formatter, value.object(), nullptr));
+    if (result.isNull()) {
+        PyErr_Print();
+        return {};
+    }
+    if (PyUnicode_Check(result.object()) != 0)
+        return PySide::pyUnicodeToQString(result.object());
+    Shiboken::AutoDecRef str(PyObject_Str(result.object()));
+    if (str.isNull()) {
+        PyErr_Print();
+        return {};
+    }
+    return PySide::pyUnicodeToQString(str.object());
+}
+
+// Sorting: NaN values are sorted last in ascending order, strings compare
+// by code units, which works with the zero padding.
+template <class T>
+static inline bool lessThan(T a, T b)
+{
+    if constexpr (std::is_floating_point_v<T>)
+        return !std::isnan(a) && (std::isnan(b) || a < b);
+    else
+        return a < b;
+}
+
+template <class Value, class Loader>
+static void sortRowsHelper(std::vector<int> &rows, Loader loader, Qt::SortOrder order)
+{
+    if (order == Qt::AscendingOrder) {
+        std::stable_sort(rows.begin(), rows.end(), [&loader](int r1, int r2) {
+            return lessThan<Value>(loader(r1), loader(r2));
+        });
+    } else {
+        std::stable_sort(rows.begin(), rows.end(), [&loader](int r1, int r2) {
+            return lessThan<Value>(loader(r2), loader(r1));
+        });
+    }
+}
+
+template <class T, class Value = T>
+static void sortRows(std::vector<int> &rows, const ArrayColumn &c, Qt::SortOrder order)
+{
+    sortRowsHelper<Value>(rows, [&c](int r) { return Value(loadItem<T>(c.item(r))); }, order);
+}
+
+template <class CodeUnit>
+static void sortStringRows(std::vector<int> &rows, const ArrayColumn &c, Qt::SortOrder order)
+{
+    const size_t size = size_t(c.view.itemsize) / sizeof(CodeUnit);
+    auto less = [&c, size](int r1, int r2) {
+        const char *p1 = c.item(r1);
+        const char *p2 = c.item(r2);
+        for (size_t i = 0; i < size; ++i) {
+            const auto u1 = loadItem<CodeUnit>(p1 + i * sizeof(CodeUnit));
+            const auto u2 = loadItem<CodeUnit>(p2 + i * sizeof(CodeUnit));
+            if (u1 != u2)
+                return u1 < u2;
+        }
+        return false;
+    };
+    if (order == Qt::AscendingOrder)
+        std::stable_sort(rows.begin(), rows.end(), less);
+    else
+        std::stable_sort(rows.begin(), rows.end(), [&less](int r1, int r2) { return less(r2, r1); });
+}
+
+static void sortRows(std::vector<int> &rows, const ArrayColumn &c, Qt::SortOrder order)
+{
+    switch (c.type) {
+    case ColumnType::Int8:
+        sortRows<qint8>(rows, c, order);
+        break;
+    case ColumnType::UInt8:
+    case ColumnType::Bool:
+        sortRows<quint8>(rows, c, order);
+        break;
+    case ColumnType::Int16:
+        sortRows<qint16>(rows, c, order);
+        break;
+    case ColumnType::UInt16:
+        sortRows<quint16>(rows, c, order);
+        break;
+    case ColumnType::Int32:
+        sortRows<qint32>(rows, c, order);
+        break;
+    case ColumnType::UInt32:
+        sortRows<quint32>(rows, c, order);
+        break;
+    case ColumnType::Int64:
+        sortRows<qint64>(rows, c, order);
+        break;
+    case ColumnType::UInt64:
+        sortRows<quint64>(rows, c, order);
+        break;
+    case ColumnType::Half:
+        sortRows<qfloat16, float>(rows, c, order);
+        break;
+    case ColumnType::Float:
+        sortRows<float>(rows, c, order);
+        break;
+    case ColumnType::Double:
+        sortRows<double>(rows, c, order);
+        break;
+    case ColumnType::Bytes:
+        sortStringRows<quint8>(rows, c, order);
+        break;
+    case ColumnType::Ucs4:
+        sortStringRows<char32_t>(rows, c, order);
+        break;
+    }
+}
+
+// Acquire a buffer of a one-dimensional array, sets a Python error on failure.
+static bool acquireColumn(PyObject *array, ArrayColumn *column)
+{
+    if (PyObject_GetBuffer(array, &column->view, PyBUF_RECORDS_RO) != 0)
+        return false;
+    const char *error = nullptr;
+    if (column->view.ndim != 1)
+        error = "QPyArrayTableModel: The array must be one-dimensional.";
+    else if (column->view.shape[0] > INT_MAX)
+        error = "QPyArrayTableModel: The array is too large.";
+    if (error == nullptr) {
+        if (auto type = PySide::Numpy::bufferType(column->view))
+            column->type = type.value();
+        else
+            error = "QPyArrayTableModel: Unsupported array type.";
+    }
+    if (error != nullptr) {
+        PyBuffer_Release(&column->view);
+        PyErr_SetString(PyExc_ValueError, error);
+        return false;
+    }
+    return true;
+}
+
+static void releaseColumn(ArrayColumn *column)
+{
+    PyBuffer_Release(&column->view);
+    Py_XDECREF(column->formatter);
+    column->formatter = nullptr;
+}
+
+QPyArrayTableModel::QPyArrayTableModel(QObject *parent) :
+    QAbstractTableModel(parent),
+    d(new QPyArrayTableModelPrivate)
+{
+}
+
+QPyArrayTableModel::~QPyArrayTableModel()
+{
+    if (Py_IsInitialized() != 0 && !d->columns.isEmpty()) {
+        Shiboken::GilState state;
+        for (auto &c : d->columns)
+            releaseColumn(&c);
+    }
+}
+
+int QPyArrayTableModel::rowCount(const QModelIndex &parent) const
+{
+    return parent.isValid() ? 0 : d->rowCount;
+}
+
+int QPyArrayTableModel::columnCount(const QModelIndex &parent) const
+{
+    return parent.isValid() ? 0 : int(d->columns.size());
+}
+
+QVariant QPyArrayTableModel::data(const QModelIndex &index, int role) const
+{
+    if (!checkIndex(index, CheckIndexOption::IndexIsValid | CheckIndexOption::ParentIsInvalid))
+        return {};
+    const auto &c = d->columns.at(index.column());
+    const Py_ssize_t row = d->sourceRow(index.row());
+    switch (role) {
+    case Qt::DisplayRole:
+        return c.formatter != nullptr ? formatValue(c, row) : columnValue(c, row);
+    case Qt::EditRole:
+        return columnValue(c, row);
+    case Qt::TextAlignmentRole:
+        if (c.type != ColumnType::Bytes && c.type != ColumnType::Ucs4)
+            return QVariant(Qt::AlignRight | Qt::AlignVCenter);
+        break;
+    default:
+        break;
+    }
+    return {};
+}
+
+QVariant QPyArrayTableModel::headerData(int section, Qt::Orientation orientation,
+                                        int role) const
+{
+    if (orientation == Qt::Horizontal && role == Qt::DisplayRole
+        && section >= 0 && section < d->columns.size()) {
+        return d->columns.at(section).header;
+    }
+    return QAbstractTableModel::headerData(section, orientation, role);
+}
+
+bool QPyArrayTableModel::setHeaderData(int section, Qt::Orientation orientation,
+                                       const QVariant &value, int role)
+{
+    if (orientation != Qt::Horizontal || (role != Qt::DisplayRole && role != Qt::EditRole)
+        || section < 0 || section >= d->columns.size()) {
+        return false;
+    }
+    d->columns[section].header = value.toString();
+    emit headerDataChanged(orientation, section, section);
+    return true;
+}
+
+Qt::ItemFlags QPyArrayTableModel::flags(const QModelIndex &index) const
+{
+    if (!index.isValid())
+        return Qt::NoItemFlags;
+    return Qt::ItemIsSelectable | Qt::ItemIsEnabled | Qt::ItemNeverHasChildren;
+}
+
+bool QPyArrayTableModel::removeColumns(int column, int count, const QModelIndex &parent)
+{
+    if (parent.isValid() || column < 0 || count <= 0 || column + count > d->columns.size())
+        return false;
+    if (count == d->columns.size()) {
+        clear();
+        return true;
+    }
+    beginRemoveColumns(parent, column, column + count - 1);
+    {
+        Shiboken::GilState state;
+        for (int c = column; c < column + count; ++c)
+            releaseColumn(&d->columns[c]);
+    }
+    d->columns.remove(column, count);
+    if (d->sortColumn >= column + count)
+        d->sortColumn -= count;
+    else if (d->sortColumn >= column)
+        d->sortColumn = -1;
+    endRemoveColumns();
+    return true;
+}
+
+void QPyArrayTableModel::sort(int column, Qt::SortOrder order)
+{
+    if (column < 0 || column >= d->columns.size()) {
+        if (d->rows.empty())
+            return;
+        column = -1; // Restore the order of the arrays
+    }
+
+    emit layoutAboutToBeChanged({}, QAbstractItemModel::VerticalSortHint);
+    const QModelIndexList oldPersistent = persistentIndexList();
+    std::vector<Py_ssize_t> persistentRows;
+    persistentRows.reserve(size_t(oldPersistent.size()));
+    for (const auto &index : oldPersistent)
+        persistentRows.push_back(d->sourceRow(index.row()));
+
+    if (column >= 0) {
+        if (d->rows.size() != size_t(d->rowCount)) {
+            d->rows.resize(size_t(d->rowCount));
+            for (int r = 0; r < d->rowCount; ++r)
+                d->rows[r] = r;
+        }
+        sortRows(d->rows, d->columns.at(column), order);
+    } else {
+        d->rows.clear();
+    }
+    d->sortColumn = column;
+    d->sortOrder = order;
+
+    if (!oldPersistent.isEmpty()) {
+        std::vector<int> viewRows;
+        if (!d->rows.empty()) {
+            viewRows.resize(d->rows.size());
+            for (size_t r = 0; r < d->rows.size(); ++r)
+                viewRows[size_t(d->rows[r])] = int(r);
+        }
+        QModelIndexList newPersistent;
+        newPersistent.reserve(oldPersistent.size());
+        for (qsizetype i = 0; i < oldPersistent.size(); ++i) {
+            const auto sourceRow = persistentRows.at(size_t(i));
+            const int row = viewRows.empty() ? int(sourceRow) : viewRows.at(size_t(sourceRow));
+            newPersistent.append(index(row, oldPersistent.at(i).column()));
+        }
+        changePersistentIndexList(oldPersistent, newPersistent);
+    }
+    emit layoutChanged({}, QAbstractItemModel::VerticalSortHint);
+}
+
+void QPyArrayTableModel::clear()
+{
+    beginResetModel();
+    if (!d->columns.isEmpty()) {
+        Shiboken::GilState state;
+        for (auto &c : d->columns)
+            releaseColumn(&c);
+    }
+    d->columns.clear();
+    d->rows.clear();
+    d->rowCount = 0;
+    d->sortColumn = -1;
+    endResetModel();
+}
+
+void QPyArrayTableModel::notifyDataChanged(int firstRow, int lastRow)
+{
+    if (d->rowCount == 0 || d->columns.isEmpty())
+        return;
+    if (lastRow < 0 || lastRow >= d->rowCount)
+        lastRow = d->rowCount - 1;
+    firstRow = std::max(firstRow, 0);
+    if (firstRow > lastRow)
+        return;
+    // The rows are those of the arrays, which are scattered when sorted.
+    if (!d->rows.empty()) {
+        firstRow = 0;
+        lastRow = d->rowCount - 1;
+    }
+    emit dataChanged(index(firstRow, 0), index(lastRow, int(d->columns.size()) - 1));
+}
+
+// Called with the GIL held from the Python API
+bool QPyArrayTableModel::_addColumnHelper(_object *array, const QString &header,
+                                          _object *formatter)
+{
+    if (formatter != nullptr && formatter != Py_None && PyCallable_Check(formatter) == 0) {
+        PyErr_SetString(PyExc_TypeError, "QPyArrayTableModel: The formatter must be callable.");
+        return false;
+    }
+    ArrayColumn column;
+    if (!acquireColumn(array, &column))
+        return false;
+    if (!d->columns.isEmpty() && column.size() != d->rowCount) {
+        PyBuffer_Release(&column.view);
+        PyErr_SetString(PyExc_ValueError,
+                        "QPyArrayTableModel: The array size does not match the row count.");
+        return false;
+    }
+    column.header = header;
+    if (formatter != nullptr && formatter != Py_None) {
+        Py_INCREF(formatter);
+        column.formatter = formatter;
+    }
+
+    const int newColumn = int(d->columns.size());
+    if (newColumn == 0) {
+        beginResetModel();
+        d->columns.append(column);
+        d->rowCount = int(column.size());
+        d->rows.clear();
+        endResetModel();
+    } else {
+        beginInsertColumns({}, newColumn, newColumn);
+        d->columns.append(column);
+        endInsertColumns();
+    }
+    return true;
+}
+
+bool QPyArrayTableModel::_setColumnArrayHelper(int column, _object *array)
+{
+    if (column < 0 || column >= d->columns.size()) {
+        PyErr_SetString(PyExc_IndexError, "QPyArrayTableModel: Invalid column.");
+        return false;
+    }
+    ArrayColumn newColumn;
+    if (!acquireColumn(array, &newColumn))
+        return false;
+
+    auto &c = d->columns[column];
+    newColumn.header = c.header;
+    newColumn.formatter = std::exchange(c.formatter, nullptr);
+    const bool sizeChanged = newColumn.size() != d->rowCount;
+    if (sizeChanged && d->columns.size() > 1) {
+        PyBuffer_Release(&newColumn.view);
+        c.formatter = newColumn.formatter;
+        PyErr_SetString(PyExc_ValueError,
+                        "QPyArrayTableModel: The array size does not match the row count.");
+        return false;
+    }
+
+    if (sizeChanged)
+        beginResetModel();
+    PyBuffer_Release(&c.view);
+    c = newColumn;
+    if (sizeChanged) {
+        d->rowCount = int(c.size());
+        d->rows.clear();
+        d->sortColumn = -1;
+        endResetModel();
+    } else if (d->sortColumn == column) {
+        sort(column, d->sortOrder);
+        notifyDataChanged();
+    } else {
+        emit dataChanged(index(0, column), index(d->rowCount - 1, column));
+    }
+    return true;
+}
+
+bool QPyArrayTableModel::_setColumnFormatterHelper(int column, _object *formatter)
+{
+    if (column < 0 || column >= d->columns.size()) {
+        PyErr_SetString(PyExc_IndexError, "QPyArrayTableModel: Invalid column.");
+        return false;
+    }
+    if (formatter != Py_None && PyCallable_Check(formatter) == 0) {
+        PyErr_SetString(PyExc_TypeError, "QPyArrayTableModel: The formatter must be callable.");
+        return false;
+    }
+    auto &c = d->columns[column];
+    Py_XDECREF(c.formatter);
+    c.formatter = nullptr;
+    if (formatter != Py_None) {
+        Py_INCREF(formatter);
+        c.formatter = formatter;
+    }
+    if (d->rowCount > 0)
+        emit dataChanged(index(0, column), index(d->rowCount - 1, column), {Qt::DisplayRole});
+    return true;
+}
+
+_object *QPyArrayTableModel::_columnArrayHelper(int column) const
+{
+    if (column < 0 || column >= d->columns.size()) {
+        PyErr_SetString(PyExc_IndexError, "QPyArrayTableModel: Invalid column.");
+        return nullptr;
+    }
+    PyObject *result = d->columns.at(column).view.obj;
+    Py_INCREF(result);
+    return result;
+}
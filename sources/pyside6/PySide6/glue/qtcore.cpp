@@ -321,13 +321,17 @@ PyModule_AddStringConstant(module, "__version__", qVersion());
 
 // @snippet qobject-connect-4
 // %FUNCTION_NAME() - disable generation of function call.
-%RETURN_TYPE %0 = PySide::qobjectConnectCallback(%1, %2, %PYARG_3, %4);
+%RETURN_TYPE %0 = %5
+    ? PySide::qobjectConnectCoalescedCallback(%1, %2, %PYARG_3, %4)
+    : PySide::qobjectConnectCallback(%1, %2, %PYARG_3, %4);
 %PYARG_0 = %CONVERTTOPYTHON[%RETURN_TYPE](%0);
 // @snippet qobject-connect-4
 
 // @snippet qobject-connect-5
 // %FUNCTION_NAME() - disable generation of function call.
-%RETURN_TYPE %0 = PySide::qobjectConnectCallback(%CPPSELF, %1, %PYARG_2, %3);
+%RETURN_TYPE %0 = %4
+    ? PySide::qobjectConnectCoalescedCallback(%CPPSELF, %1, %PYARG_2, %3)
+    : PySide::qobjectConnectCallback(%CPPSELF, %1, %PYARG_2, %3);
 %PYARG_0 = %CONVERTTOPYTHON[%RETURN_TYPE](%0);
 // @snippet qobject-connect-5
 
@@ -354,6 +358,10 @@ PyModule_AddStringConstant(module, "__version__", qVersion());
 %PYARG_0 = %CONVERTTOPYTHON[%RETURN_TYPE](%0);
 // @snippet qobject-disconnect-2
 
+// @snippet qobject-disconnect-connection
+PySide::qobjectReleaseDisconnectedCoalescedCallbacks();
+// @snippet qobject-disconnect-connection
+
 // @snippet qfatal
 // qFatal doesn't have a stream version, so we do a
 // qWarning call followed by a qFatal() call using a
@@ -581,6 +589,22 @@ pyResult = %PYSELF;
 qRegisterMetaType<QList<int> >("QList<int>");
 // @snippet qabstractitemmodel
 
+// @snippet qpyarraytablemodel-addcolumn
+%CPPSELF._addColumnHelper(%PYARG_1, %2, %3);
+// @snippet qpyarraytablemodel-addcolumn
+
+// @snippet qpyarraytablemodel-setcolumnarray
+%CPPSELF._setColumnArrayHelper(%1, %PYARG_2);
+// @snippet qpyarraytablemodel-setcolumnarray
+
+// @snippet qpyarraytablemodel-setcolumnformatter
+%CPPSELF._setColumnFormatterHelper(%1, %PYARG_2);
+// @snippet qpyarraytablemodel-setcolumnformatter
+
+// @snippet qpyarraytablemodel-columnarray
+%PYARG_0 = %CPPSELF._columnArrayHelper(%1);
+// @snippet qpyarraytablemodel-columnarray
+
 // @snippet qobject-metaobject
 %RETURN_TYPE %0 = %CPPSELF.%FUNCTION_NAME();
 %PYARG_0 = %CONVERTTOPYTHON[%RETURN_TYPE](%0);
@@ -993,6 +1017,12 @@ auto *ptr = reinterpret_cast<uchar *>(Shiboken::Buffer::getPointer(%PYARG_1, &si
 %PYARG_0 = %CONVERTTOPYTHON[%RETURN_TYPE](%0);
 // @snippet qtranslator-load
 
+// @snippet qobject-tr-invalidate
+// Reloading an installed translator posts QEvent::LanguageChange; invalidate
+// the QObject.tr() context cache right away.
+qObjectTrInvalidateCache();
+// @snippet qobject-tr-invalidate
+
 // @snippet qtimer-singleshot-1
 // %FUNCTION_NAME() - disable generation of c++ function call
 (void) %2; // remove warning about unused variable
@@ -1114,6 +1144,19 @@ if (result == -1) {
 }
 // @snippet qdatastream-readrawdata
 
+// @snippet qdatastream-readrawdatainto
+Py_buffer view;
+if (PyObject_GetBuffer(%PYARG_1, &view, PyBUF_WRITABLE) == 0) {
+    const int size = int(std::min(view.len, Py_ssize_t(std::numeric_limits<int>::max())));
+    int result = 0;
+    Py_BEGIN_ALLOW_THREADS
+    result = %CPPSELF.readRawData(static_cast<char *>(view.buf), size);
+    Py_END_ALLOW_THREADS
+    PyBuffer_Release(&view);
+    %PYARG_0 = %CONVERTTOPYTHON[int](result);
+}
+// @snippet qdatastream-readrawdatainto
+
 // @snippet qdatastream-writerawdata
 int r = 0;
 Py_BEGIN_ALLOW_THREADS
@@ -1245,6 +1288,18 @@ Py_END_ALLOW_THREADS
 %PYARG_0 = Shiboken::String::fromCString(ba.constData());
 // @snippet qiodevice-readData
 
+// @snippet qiodevice-readinto
+Py_buffer view;
+if (PyObject_GetBuffer(%PYARG_1, &view, PyBUF_WRITABLE) == 0) {
+    qint64 result = 0;
+    Py_BEGIN_ALLOW_THREADS
+    result = %CPPSELF.read(static_cast<char *>(view.buf), qint64(view.len));
+    Py_END_ALLOW_THREADS
+    PyBuffer_Release(&view);
+    %PYARG_0 = %CONVERTTOPYTHON[qint64](result);
+}
+// @snippet qiodevice-readinto
+
 // @snippet qt-module-shutdown
 { // Avoid name clash
     Shiboken::AutoDecRef regFunc(static_cast<PyObject *>(nullptr));
@@ -382,8 +382,264 @@ static void imageDecrefDataHandler(void *data)
     Py_DECREF(reinterpret_cast<PyObject *>(data));
     PyGILState_Release(state);
 }
+
+static void imageReleaseBufferHandler(void *data)
+{
+    auto state = PyGILState_Ensure();
+    auto *view = reinterpret_cast<Py_buffer *>(data);
+    PyBuffer_Release(view);
+    delete view;
+    PyGILState_Release(state);
+}
 // @snippet qimage-decref-image-data
 
+// @snippet qimage-bufferprotocol
+// QImage buffer protocol exposing the pixels as an array of shape
+// (height, width, channels), or (height, width) for formats with one
+// channel or packed pixels. The strides honor the padding of the scan lines.
+// see: http://www.python.org/dev/peps/pep-3118/
+
+struct QImageArrayLayout
+{
+    Py_ssize_t channels = 0; // 0: Unsupported format
+    Py_ssize_t channelSize = 0;
+    const char *format = nullptr; // struct module syntax
+};
+
+static QImageArrayLayout qImageArrayLayout(QImage::Format format)
+{
+    switch (format) {
+    case QImage::Format_Indexed8:
+    case QImage::Format_Alpha8:
+    case QImage::Format_Grayscale8:
+        return {1, 1, "B"};
+    case QImage::Format_Grayscale16:
+    case QImage::Format_RGB16:
+    case QImage::Format_RGB555:
+    case QImage::Format_RGB444:
+    case QImage::Format_ARGB4444_Premultiplied:
+        return {1, 2, "H"};
+    case QImage::Format_BGR30:
+    case QImage::Format_A2BGR30_Premultiplied:
+    case QImage::Format_RGB30:
+    case QImage::Format_A2RGB30_Premultiplied:
+        return {1, 4, "I"};
+    case QImage::Format_RGB888:
+    case QImage::Format_BGR888:
+        return {3, 1, "B"};
+    // Byte order of memory, that is BGRA for Format_ARGB32 on little endian
+    case QImage::Format_RGB32:
+    case QImage::Format_ARGB32:
+    case QImage::Format_ARGB32_Premultiplied:
+    case QImage::Format_RGBX8888:
+    case QImage::Format_RGBA8888:
+    case QImage::Format_RGBA8888_Premultiplied:
+#if QT_VERSION >= QT_VERSION_CHECK(6, 8, 0)
+    case QImage::Format_CMYK8888:
+#endif
+        return {4, 1, "B"};
+    case QImage::Format_RGBX64:
+    case QImage::Format_RGBA64:
+    case QImage::Format_RGBA64_Premultiplied:
+        return {4, 2, "H"};
+    case QImage::Format_RGBX16FPx4:
+    case QImage::Format_RGBA16FPx4:
+    case QImage::Format_RGBA16FPx4_Premultiplied:
+        return {4, 2, "e"};
+    case QImage::Format_RGBX32FPx4:
+    case QImage::Format_RGBA32FPx4:
+    case QImage::Format_RGBA32FPx4_Premultiplied:
+        return {4, 4, "f"};
+    // The bytes of the packed 24-bit formats (RGB666, ARGB8565, ...) are not
+    // channels and there is no 3-byte item type for the whole pixel.
+    default: // Invalid, bit-packed Mono and packed 24-bit formats
+        break;
+    }
+    return {};
+}
+
+// Shape and strides of an exported view, released with the view
+struct QImageBufferInfo
+{
+    Py_ssize_t shape[3];
+    Py_ssize_t strides[3];
+};
+
+extern "C" {
+
+static int SbkQImage_getbufferproc(PyObject *obj, Py_buffer *view, int flags)
+{
+    if (!view || !Shiboken::Object::isValid(obj))
+        return -1;
+
+    QImage * cppSelf = %CONVERTTOCPP[QImage *](obj);
+    const auto layout = qImageArrayLayout(cppSelf->format());
+    if (layout.channels == 0) {
+        PyErr_SetString(PyExc_BufferError,
+                        "QImage: The buffer protocol is not supported for this image format.");
+        view->obj = nullptr;
+        return -1;
+    }
+
+    const Py_ssize_t height = cppSelf->height();
+    const Py_ssize_t width = cppSelf->width();
+    const Py_ssize_t pixelSize = layout.channels * layout.channelSize;
+    const Py_ssize_t bytesPerLine = cppSelf->bytesPerLine();
+    const bool contiguous = bytesPerLine == width * pixelSize;
+    const bool nd = (flags & PyBUF_ND) == PyBUF_ND;
+    const bool strided = (flags & PyBUF_STRIDES) == PyBUF_STRIDES;
+    const int contiguityFlags = PyBUF_C_CONTIGUOUS | PyBUF_F_CONTIGUOUS | PyBUF_ANY_CONTIGUOUS;
+    if (nd && !contiguous
+        && (!strided || (flags & contiguityFlags & ~PyBUF_STRIDES) != 0)) {
+        PyErr_SetString(PyExc_BufferError,
+                        "QImage: The scan lines are padded, a strided buffer is required.");
+        view->obj = nullptr;
+        return -1;
+    }
+
+    const bool writable = (flags & PyBUF_WRITABLE) == PyBUF_WRITABLE;
+    // bits() detaches shared image data
+    uchar *data = writable ? cppSelf->bits() : const_cast<uchar *>(cppSelf->constBits());
+
+    view->obj = obj;
+    view->buf = data;
+    view->readonly = writable ? 0 : 1;
+    const bool withFormat = (flags & PyBUF_FORMAT) == PyBUF_FORMAT;
+    view->format = nullptr;
+    view->suboffsets = nullptr;
+    view->internal = nullptr;
+    if (nd) {
+        auto *info = new QImageBufferInfo{{height, width, layout.channels},
+                                          {bytesPerLine, pixelSize, layout.channelSize}};
+        view->len = height * width * pixelSize;
+        view->itemsize = layout.channelSize;
+        if (withFormat)
+            view->format = const_cast<char *>(layout.format);
+        view->ndim = layout.channels > 1 ? 3 : 2;
+        view->shape = info->shape;
+        view->strides = strided ? info->strides : nullptr;
+        view->internal = info;
+    } else { // Plain bytes including padding
+        view->len = cppSelf->sizeInBytes();
+        view->itemsize = 1;
+        if (withFormat)
+            view->format = const_cast<char *>("B");
+        view->ndim = 1;
+        view->shape = nullptr;
+        view->strides = nullptr;
+    }
+
+    Py_XINCREF(obj);
+    return 0;
+}
+
+static void SbkQImage_releasebufferproc(PyObject * /* obj */, Py_buffer *view)
+{
+    delete reinterpret_cast<QImageBufferInfo *>(view->internal);
+    view->internal = nullptr;
+}
+
+static PyBufferProcs SbkQImageBufferProc = {
+    /*bf_getbuffer*/  (getbufferproc)SbkQImage_getbufferproc,
+    /*bf_releasebuffer*/ (releasebufferproc)SbkQImage_releasebufferproc,
+};
+
+}
+
+// Check the struct module format of an array against the image format.
+static bool qImageArrayFormatMatches(const char *format, const char *expected)
+{
+    if (format == nullptr) // Unsigned bytes
+        format = "B";
+    switch (*format) { // Native byte order only
+    case '@':
+    case '=':
+#if Q_BYTE_ORDER == Q_LITTLE_ENDIAN
+    case '<':
+#else
+    case '>':
+    case '!':
+#endif
+        ++format;
+        break;
+    default:
+        break;
+    }
+    const auto isFloat = [](char c) { return c == 'e' || c == 'f' || c == 'd'; };
+    return format[0] != '\0' && format[1] == '\0'
+        && isFloat(format[0]) == isFloat(expected[0]);
+}
+
+// Create an image referencing the data of an array-like object of shape
+// (height, width[, channels]), which is kept alive by the image.
+static QImage qImageFromArray(PyObject *array, QImage::Format format)
+{
+    const auto layout = qImageArrayLayout(format);
+    if (layout.channels == 0) {
+        PyErr_SetString(PyExc_ValueError, "QImage: Unsupported image format for arrays.");
+        return {};
+    }
+
+    auto *view = new Py_buffer;
+    bool writable = PyObject_GetBuffer(array, view, PyBUF_RECORDS) == 0;
+    if (!writable) {
+        PyErr_Clear();
+        if (PyObject_GetBuffer(array, view, PyBUF_RECORDS_RO) != 0) {
+            delete view;
+            return {};
+        }
+    }
+
+    const Py_ssize_t channels = view->ndim == 3 ? view->shape[2] : 1;
+    const Py_ssize_t pixelSize = layout.channels * layout.channelSize;
+    const char *error = nullptr;
+    if (view->ndim != 2 && view->ndim != 3)
+        error = "QImage: The array must have 2 or 3 dimensions.";
+    else if (channels != layout.channels || view->itemsize != layout.channelSize
+             || !qImageArrayFormatMatches(view->format, layout.format))
+        error = "QImage: The array type or number of channels does not match the image format.";
+    else if (view->shape[0] <= 0 || view->shape[1] <= 0
+             || view->shape[0] > INT_MAX || view->shape[1] > INT_MAX)
+        error = "QImage: Invalid array size.";
+    else if (view->strides[1] != pixelSize
+             || (view->ndim == 3 && view->strides[2] != layout.channelSize)
+             || view->strides[0] < view->shape[1] * pixelSize)
+        error = "QImage: The pixels of the array must be contiguous.";
+    if (error != nullptr) {
+        PyErr_SetString(PyExc_ValueError, error);
+        PyBuffer_Release(view);
+        delete view;
+        return {};
+    }
+
+    const int width = int(view->shape[1]);
+    const int height = int(view->shape[0]);
+    const qsizetype bytesPerLine = view->strides[0];
+    // QImage detaches on modification when created from const data
+    QImage result = writable
+        ? QImage(static_cast<uchar *>(view->buf), width, height, bytesPerLine, format,
+                 imageReleaseBufferHandler, view)
+        : QImage(static_cast<const uchar *>(view->buf), width, height, bytesPerLine, format,
+                 imageReleaseBufferHandler, view);
+    if (result.isNull()) { // Qt does not invoke the cleanup function in that case
+        PyErr_SetString(PyExc_ValueError, "QImage: Unable to create an image from the array.");
+        PyBuffer_Release(view);
+        delete view;
+    }
+    return result;
+}
+// @snippet qimage-bufferprotocol
+
+// @snippet qimage-buffer-py3
+PepType_AS_BUFFER(Shiboken::SbkType<QImage>()) = &SbkQImageBufferProc;
+// @snippet qimage-buffer-py3
+
+// @snippet qimage-array-constructor
+const QImage image = qImageFromArray(%PYARG_1, %2);
+if (!image.isNull())
+    %0 = new %TYPE(image);
+// @snippet qimage-array-constructor
+
 // @snippet qimage-constbits
 %PYARG_0 = Shiboken::Buffer::newObject(%CPPSELF.%FUNCTION_NAME(), %CPPSELF.sizeInBytes());
 // @snippet qimage-constbits
@@ -673,6 +929,160 @@ for (int r=0, r_max = %CPPSELF.rowCount(); r < r_max; r++) {
 }
 // @snippet qstandarditemmodel-clear
 
+// @snippet qstandarditemmodel-bulk-helpers
+// Return the values of a row or column. One-dimensional arrays supporting
+// the buffer protocol are read natively.
+static bool standardItemModelValues(PyObject *values, QVariantList *result)
+{
+    if (auto array = PySide::Numpy::arrayToVariantList(values)) {
+        *result = std::move(array.value());
+        return true;
+    }
+    Shiboken::AutoDecRef list(PySequence_Fast(values, "QStandardItemModel: A sequence is expected."));
+    if (list.isNull())
+        return false;
+    const Py_ssize_t size = PySequence_Fast_GET_SIZE(list.object());
+    result->reserve(size);
+    for (Py_ssize_t i = 0; i < size; ++i) {
+        PyObject *pyValue = PySequence_Fast_GET_ITEM(list.object(), i);
+        result->append(%CONVERTTOCPP[QVariant](pyValue));
+    }
+    return PyErr_Occurred() == nullptr;
+}
+
+// Return the rows of a block. Two-dimensional arrays supporting the buffer
+// protocol are read natively.
+static bool standardItemModelRows(PyObject *rows, QList<QVariantList> *result)
+{
+    if (auto array = PySide::Numpy::arrayToVariantRows(rows)) {
+        *result = std::move(array.value());
+        return true;
+    }
+    Shiboken::AutoDecRef list(PySequence_Fast(rows, "QStandardItemModel: A sequence is expected."));
+    if (list.isNull())
+        return false;
+    const Py_ssize_t size = PySequence_Fast_GET_SIZE(list.object());
+    result->resize(size);
+    for (Py_ssize_t r = 0; r < size; ++r) {
+        if (!standardItemModelValues(PySequence_Fast_GET_ITEM(list.object(), r), &(*result)[r]))
+            return false;
+    }
+    return true;
+}
+
+static QStandardItem *standardItemModelNewItem(const QStandardItemModel *model)
+{
+    const QStandardItem *prototype = model->itemPrototype();
+    return prototype != nullptr ? prototype->clone() : new QStandardItem;
+}
+
+// Set the data of a block of cells with the model signals blocked, so that
+// views only receive a single notification. The items are created in C++,
+// no Python wrappers are involved. itemChanged() is emitted for each item
+// afterwards as QStandardItem::setData() would do. Returns the items by row.
+static QList<QList<QStandardItem *>>
+    standardItemModelSetBlock(QStandardItemModel *model, int firstRow, int column,
+                              const QList<QVariantList> &rows, int role)
+{
+    qsizetype columnCount = 0;
+    for (const auto &row : rows)
+        columnCount = std::max(columnCount, row.size());
+    if (rows.isEmpty() || columnCount == 0)
+        return {};
+    const int lastRow = firstRow + int(rows.size()) - 1;
+    const int lastColumn = column + int(columnCount) - 1;
+    if (model->rowCount() <= lastRow)
+        model->setRowCount(lastRow + 1);
+    if (model->columnCount() <= lastColumn)
+        model->setColumnCount(lastColumn + 1);
+
+    QList<QList<QStandardItem *>> items(rows.size());
+    bool createdItems = false;
+    {
+        const QSignalBlocker blocker(model);
+        for (qsizetype r = 0, size = rows.size(); r < size; ++r) {
+            const auto &row = rows.at(r);
+            items[r].reserve(row.size());
+            for (qsizetype c = 0, columns = row.size(); c < columns; ++c) {
+                const int modelRow = firstRow + int(r);
+                const int modelColumn = column + int(c);
+                QStandardItem *item = model->item(modelRow, modelColumn);
+                if (item == nullptr) {
+                    item = standardItemModelNewItem(model);
+                    item->setData(row.at(c), role);
+                    model->setItem(modelRow, modelColumn, item);
+                    createdItems = true;
+                } else {
+                    item->setData(row.at(c), role);
+                }
+                items[r].append(item);
+            }
+        }
+    }
+    const QList<int> roles = createdItems ? QList<int>{} : QList<int>{role};
+    emit model->dataChanged(model->index(firstRow, column),
+                            model->index(lastRow, lastColumn), roles);
+    for (const auto &row : std::as_const(items)) {
+        for (auto *item : row)
+            emit model->itemChanged(item);
+    }
+    return items;
+}
+
+// Return the items as list (of lists) owned by the model
+static PyObject *standardItemModelItemList(PyObject *pyModel, const QList<QStandardItem *> &items)
+{
+    PyObject *result = PyList_New(items.size());
+    for (qsizetype i = 0, size = items.size(); i < size; ++i)
+        PyList_SET_ITEM(result, i, %CONVERTTOPYTHON[QStandardItem *](items.at(i)));
+    Shiboken::Object::setParent(pyModel, result);
+    return result;
+}
+
+static PyObject *standardItemModelItemRows(PyObject *pyModel,
+                                           const QList<QList<QStandardItem *>> &rows)
+{
+    PyObject *result = PyList_New(rows.size());
+    for (qsizetype r = 0, size = rows.size(); r < size; ++r)
+        PyList_SET_ITEM(result, r, standardItemModelItemList(pyModel, rows.at(r)));
+    return result;
+}
+// @snippet qstandarditemmodel-bulk-helpers
+
+// @snippet qstandarditemmodel-appendrows
+QList<QVariantList> data;
+if (standardItemModelRows(%PYARG_1, &data)) {
+    const auto items = standardItemModelSetBlock(%CPPSELF, %CPPSELF->rowCount(), 0, data, %2);
+    if (%3) {
+        %PYARG_0 = standardItemModelItemRows(%PYSELF, items);
+    } else {
+        %PYARG_0 = Py_None;
+        Py_INCREF(%PYARG_0);
+    }
+}
+// @snippet qstandarditemmodel-appendrows
+
+// @snippet qstandarditemmodel-setcolumndata
+QVariantList values;
+if (standardItemModelValues(%PYARG_2, &values)) {
+    QList<QVariantList> data;
+    data.reserve(values.size());
+    for (const auto &value : std::as_const(values))
+        data.append(QVariantList{value});
+    const auto items = standardItemModelSetBlock(%CPPSELF, %3, %1, data, %4);
+    if (%5) {
+        QList<QStandardItem *> column;
+        column.reserve(items.size());
+        for (const auto &row : items)
+            column.append(row.constFirst());
+        %PYARG_0 = standardItemModelItemList(%PYSELF, column);
+    } else {
+        %PYARG_0 = Py_None;
+        Py_INCREF(%PYARG_0);
+    }
+}
+// @snippet qstandarditemmodel-setcolumndata
+
 // @snippet qclipboard-text
 %BEGIN_ALLOW_THREADS
 %RETURN_TYPE retval_ = %CPPSELF.%FUNCTION_NAME(%1, %2);
@@ -687,6 +1097,61 @@ const auto points = PySide::Numpy::xyDataToQPointFList(%PYARG_1, %PYARG_2);
 %CPPSELF.drawPoints(points);
 // @snippet qpainter-drawpointsnp-numpy-x-y
 
+// @snippet qpainter-drawlinesnp-numpy
+const auto lines = PySide::Numpy::lineArrayToQLineFList(%PYARG_1);
+if (PyErr_Occurred() == nullptr)
+    %CPPSELF.drawLines(lines.constData(), int(lines.size()));
+// @snippet qpainter-drawlinesnp-numpy
+
+// @snippet qpainter-drawrectsnp-numpy
+const auto rects = PySide::Numpy::rectArrayToQRectFList(%PYARG_1);
+if (PyErr_Occurred() == nullptr)
+    %CPPSELF.drawRects(rects.constData(), int(rects.size()));
+// @snippet qpainter-drawrectsnp-numpy
+
+// @snippet qpainter-drawellipsesnp-numpy
+const auto rects = PySide::Numpy::rectArrayToQRectFList(%PYARG_1);
+for (const auto &rect : rects)
+    %CPPSELF.drawEllipse(rect);
+// @snippet qpainter-drawellipsesnp-numpy
+
+// @snippet qpainter-drawpolylinenp-numpy
+const auto points = PySide::Numpy::pointArrayToQPointFList(%PYARG_1);
+if (PyErr_Occurred() == nullptr)
+    %CPPSELF.drawPolyline(points.constData(), int(points.size()));
+// @snippet qpainter-drawpolylinenp-numpy
+
+// @snippet qpainter-drawpolygonnp-numpy
+const auto points = PySide::Numpy::pointArrayToQPointFList(%PYARG_1);
+if (PyErr_Occurred() == nullptr)
+    %CPPSELF.drawPolygon(points.constData(), int(points.size()), %2);
+// @snippet qpainter-drawpolygonnp-numpy
+
+// @snippet qpainter-drawcoloredpointsnp-numpy
+// Draw runs of points of the same color with the current pen modified
+const auto points = PySide::Numpy::pointArrayToQPointFList(%PYARG_1);
+const auto colors = PySide::Numpy::uintArrayToList(%PYARG_2);
+const qsizetype count = points.size();
+if (PyErr_Occurred() == nullptr && colors.size() != count) {
+    PyErr_SetString(PyExc_ValueError,
+                    "drawColoredPointsNp(): The number of points and colors differ.");
+} else if (PyErr_Occurred() == nullptr && count > 0) {
+    const QPen oldPen = %CPPSELF.pen();
+    QPen pen = oldPen;
+    for (qsizetype start = 0; start < count; ) {
+        const QRgb rgb = colors.at(start);
+        qsizetype end = start + 1;
+        while (end < count && colors.at(end) == rgb)
+            ++end;
+        pen.setColor(QColor::fromRgba(rgb));
+        %CPPSELF.setPen(pen);
+        %CPPSELF.drawPoints(points.constData() + start, int(end - start));
+        start = end;
+    }
+    %CPPSELF.setPen(oldPen);
+}
+// @snippet qpainter-drawcoloredpointsnp-numpy
+
 // @snippet qpainter-drawpolygon
 %CPPSELF.%FUNCTION_NAME(%1.constData(), %1.size(), %2);
 // @snippet qpainter-drawpolygon
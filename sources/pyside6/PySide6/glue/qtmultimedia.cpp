@@ -20,3 +20,140 @@ const unsigned char *data = %CPPSELF.%FUNCTION_NAME<unsigned char>();
 const auto size = %CPPSELF.byteCount();
 %PYARG_0 = Shiboken::Buffer::newObject(data, size);
 // @snippet qaudiobuffer-const-data
+
+// @snippet qaudiobuffer-array-helpers
+// Typed array of shape (frames, channels) of the samples of an audio buffer
+static PyObject *audioBufferArray(PyObject *owner, const QAudioBuffer &buffer, void *data,
+                                  Shiboken::Buffer::Type type)
+{
+    const QAudioFormat format = buffer.format();
+    const char *itemFormat = nullptr;
+    switch (format.sampleFormat()) {
+    case QAudioFormat::UInt8:
+        itemFormat = "B";
+        break;
+    case QAudioFormat::Int16:
+        itemFormat = "h";
+        break;
+    case QAudioFormat::Int32:
+        itemFormat = "i";
+        break;
+    case QAudioFormat::Float:
+        itemFormat = "f";
+        break;
+    default:
+        PyErr_SetString(PyExc_ValueError, "QAudioBuffer: Unknown sample format.");
+        return nullptr;
+    }
+    const Py_ssize_t shape[2] = {buffer.frameCount(), format.channelCount()};
+    const Py_ssize_t strides[2] = {format.bytesPerFrame(), format.bytesPerSample()};
+    return Shiboken::Buffer::newArrayObject(data, itemFormat, format.bytesPerSample(),
+                                            2, shape, strides, type, owner);
+}
+// @snippet qaudiobuffer-array-helpers
+
+// @snippet qaudiobuffer-array
+%PYARG_0 = audioBufferArray(%PYSELF, *%CPPSELF, %CPPSELF.data<unsigned char>(),
+                            Shiboken::Buffer::ReadWrite);
+// @snippet qaudiobuffer-array
+
+// @snippet qaudiobuffer-const-array
+%PYARG_0 = audioBufferArray(%PYSELF, *%CPPSELF,
+                            const_cast<unsigned char *>(%CPPSELF.constData<unsigned char>()),
+                            Shiboken::Buffer::ReadOnly);
+// @snippet qaudiobuffer-const-array
+
+// @snippet qvideoframe-plane-array-helpers
+// Layout of the planes of the pixel formats; subsampled planes have
+// their size divided.
+struct VideoPlaneLayout
+{
+    int widthDivisor = 1;
+    int heightDivisor = 1;
+    Py_ssize_t channels = 0; // 0: Unknown, rows of bytes are exposed
+    Py_ssize_t channelSize = 1;
+    const char *format = "B";
+};
+
+static VideoPlaneLayout videoPlaneLayout(QVideoFrameFormat::PixelFormat format, int plane)
+{
+    static constexpr VideoPlaneLayout bytes{1, 1, 1, 1, "B"};
+    static constexpr VideoPlaneLayout words{1, 1, 1, 2, "H"};
+    switch (format) {
+    case QVideoFrameFormat::Format_ARGB8888:
+    case QVideoFrameFormat::Format_ARGB8888_Premultiplied:
+    case QVideoFrameFormat::Format_XRGB8888:
+    case QVideoFrameFormat::Format_BGRA8888:
+    case QVideoFrameFormat::Format_BGRA8888_Premultiplied:
+    case QVideoFrameFormat::Format_BGRX8888:
+    case QVideoFrameFormat::Format_ABGR8888:
+    case QVideoFrameFormat::Format_XBGR8888:
+    case QVideoFrameFormat::Format_RGBA8888:
+    case QVideoFrameFormat::Format_RGBX8888:
+    case QVideoFrameFormat::Format_AYUV:
+    case QVideoFrameFormat::Format_AYUV_Premultiplied:
+        return {1, 1, 4, 1, "B"};
+    case QVideoFrameFormat::Format_UYVY: // Macro pixels of 2 pixels
+    case QVideoFrameFormat::Format_YUYV:
+        return {2, 1, 4, 1, "B"};
+    case QVideoFrameFormat::Format_Y8:
+        return bytes;
+    case QVideoFrameFormat::Format_Y16:
+        return words;
+    case QVideoFrameFormat::Format_NV12: // Interleaved UV plane
+    case QVideoFrameFormat::Format_NV21:
+        return plane == 0 ? bytes : VideoPlaneLayout{2, 2, 2, 1, "B"};
+    case QVideoFrameFormat::Format_P010:
+    case QVideoFrameFormat::Format_P016:
+        return plane == 0 ? words : VideoPlaneLayout{2, 2, 2, 2, "H"};
+    case QVideoFrameFormat::Format_YUV420P:
+    case QVideoFrameFormat::Format_YV12:
+        return plane == 0 ? bytes : VideoPlaneLayout{2, 2, 1, 1, "B"};
+    case QVideoFrameFormat::Format_YUV422P:
+        return plane == 0 ? bytes : VideoPlaneLayout{2, 1, 1, 1, "B"};
+    case QVideoFrameFormat::Format_YUV420P10:
+        return plane == 0 ? words : VideoPlaneLayout{2, 2, 1, 2, "H"};
+    default: // IMC formats, Jpeg, textures
+        break;
+    }
+    return {};
+}
+
+// Typed array of shape (height, width[, channels]) of a mapped plane
+static PyObject *videoFramePlaneArray(PyObject *owner, QVideoFrame *frame, int plane)
+{
+    if (plane < 0 || plane >= frame->planeCount()) {
+        PyErr_SetString(PyExc_IndexError, "QVideoFrame: Invalid plane index.");
+        return nullptr;
+    }
+    uchar *data = frame->bits(plane);
+    const Py_ssize_t bytesPerLine = frame->bytesPerLine(plane);
+    if (data == nullptr || bytesPerLine <= 0) {
+        PyErr_SetString(PyExc_RuntimeError, "QVideoFrame: The frame is not mapped.");
+        return nullptr;
+    }
+    const auto type = (frame->mapMode() & QVideoFrame::WriteOnly) != 0
+        ? Shiboken::Buffer::ReadWrite : Shiboken::Buffer::ReadOnly;
+    const Py_ssize_t rows = frame->mappedBytes(plane) / bytesPerLine;
+
+    const auto layout = videoPlaneLayout(frame->pixelFormat(), plane);
+    const Py_ssize_t pixelSize = layout.channels * layout.channelSize;
+    const Py_ssize_t width = (frame->width() + layout.widthDivisor - 1) / layout.widthDivisor;
+    const Py_ssize_t height = (frame->height() + layout.heightDivisor - 1) / layout.heightDivisor;
+    if (layout.channels == 0 || height > rows || width * pixelSize > bytesPerLine) {
+        const Py_ssize_t shape[2] = {rows, bytesPerLine};
+        const Py_ssize_t strides[2] = {bytesPerLine, 1};
+        return Shiboken::Buffer::newArrayObject(data, "B", 1, 2, shape, strides, type, owner);
+    }
+
+    const Py_ssize_t shape[3] = {height, width, layout.channels};
+    const Py_ssize_t strides[3] = {bytesPerLine, pixelSize, layout.channelSize};
+    const int ndim = layout.channels > 1 ? 3 : 2;
+    return Shiboken::Buffer::newArrayObject(data, layout.format, layout.channelSize,
+                                            ndim, shape, strides, type, owner);
+}
+// @snippet qvideoframe-plane-array-helpers
+
+// @snippet qvideoframe-plane-array
+%PYARG_0 = videoFramePlaneArray(%PYSELF, %CPPSELF, %1);
+// @snippet qvideoframe-plane-array
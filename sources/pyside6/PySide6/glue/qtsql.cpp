@@ -58,3 +58,134 @@ bool cppResult = static_cast<::QSqlResultWrapper *>(cppSelf)->QSqlResultWrapper:
 %END_ALLOW_THREADS
 %PYARG_0 = %CONVERTTOPYTHON[bool](cppResult);
 // @snippet qsqlresult-exec
+
+// @snippet qsqlquery-fetchcolumns-helpers
+// Storage of a column fetched by QSqlQuery.fetchColumns(). The values are
+// kept as QVariant during the fetch; the type of the column is determined
+// afterwards from the values returned by the driver.
+enum class SqlColumnKind { Empty, Bool, Integer, Double, Object };
+
+static SqlColumnKind sqlColumnKind(const QVariantList &values)
+{
+    SqlColumnKind result = SqlColumnKind::Empty;
+    bool hasNull = false;
+    for (const auto &v : values) {
+        if (v.isNull()) {
+            hasNull = true;
+            continue;
+        }
+        SqlColumnKind kind = SqlColumnKind::Object;
+        switch (v.typeId()) {
+        case QMetaType::Bool:
+            kind = SqlColumnKind::Bool;
+            break;
+        case QMetaType::Char:
+        case QMetaType::SChar:
+        case QMetaType::UChar:
+        case QMetaType::Short:
+        case QMetaType::UShort:
+        case QMetaType::Int:
+        case QMetaType::UInt:
+        case QMetaType::Long:
+        case QMetaType::LongLong:
+            kind = SqlColumnKind::Integer;
+            break;
+        case QMetaType::Float:
+        case QMetaType::Double:
+            kind = SqlColumnKind::Double;
+            break;
+        default:
+            break;
+        }
+        if (result == SqlColumnKind::Empty || result == kind)
+            result = kind;
+        else if ((result == SqlColumnKind::Integer && kind == SqlColumnKind::Double)
+                 || (result == SqlColumnKind::Double && kind == SqlColumnKind::Integer))
+            result = SqlColumnKind::Double; // SQLite has dynamic typing
+        else
+            return SqlColumnKind::Object;
+    }
+    // NULL can only be represented (as NaN) in floating point arrays
+    if (hasNull && result != SqlColumnKind::Double && result != SqlColumnKind::Empty)
+        return SqlColumnKind::Object;
+    return result;
+}
+
+template <class T, class Converter>
+static std::vector<T> sqlColumnData(const QVariantList &values, Converter converter)
+{
+    std::vector<T> result;
+    result.reserve(size_t(values.size()));
+    for (const auto &v : values)
+        result.push_back(converter(v));
+    return result;
+}
+
+static PyObject *sqlColumnToList(const QVariantList &values)
+{
+    PyObject *result = PyList_New(values.size());
+    for (qsizetype i = 0, size = values.size(); i < size; ++i) {
+        const QVariant &v = values.at(i);
+        PyObject *item = nullptr;
+        if (v.isNull()) {
+            item = Py_None;
+            Py_INCREF(item);
+        } else {
+            item = %CONVERTTOPYTHON[QVariant](v);
+        }
+        PyList_SET_ITEM(result, i, item);
+    }
+    return result;
+}
+
+static PyObject *sqlColumnToPython(const QVariantList &values, SqlColumnKind kind)
+{
+    if (!Shiboken::Numpy::isAvailable())
+        kind = SqlColumnKind::Object;
+    const auto size = Py_ssize_t(values.size());
+    switch (kind) {
+    case SqlColumnKind::Bool: {
+        const auto data = sqlColumnData<bool>(values, [](const QVariant &v) { return v.toBool(); });
+        return Shiboken::Numpy::createBoolArray1(size, data.data());
+    }
+    case SqlColumnKind::Integer: {
+        const auto data = sqlColumnData<int64_t>(values,
+                                                 [](const QVariant &v) { return v.toLongLong(); });
+        return Shiboken::Numpy::createInt64Array1(size, data.data());
+    }
+    case SqlColumnKind::Double: {
+        const auto data = sqlColumnData<double>(values, [](const QVariant &v) {
+            return v.isNull() ? std::numeric_limits<double>::quiet_NaN() : v.toDouble();
+        });
+        return Shiboken::Numpy::createDoubleArray1(size, data.data());
+    }
+    case SqlColumnKind::Empty:
+    case SqlColumnKind::Object:
+        break;
+    }
+    return sqlColumnToList(values);
+}
+// @snippet qsqlquery-fetchcolumns-helpers
+
+// @snippet qsqlquery-fetchcolumns
+const int columnCount = %CPPSELF.record().count();
+QList<QVariantList> columns(columnCount);
+const int maxRows = %1;
+%BEGIN_ALLOW_THREADS
+if (maxRows != 0 && %CPPSELF.isActive() && %CPPSELF.isSelect()) {
+    if (maxRows > 0) {
+        for (auto &c : columns)
+            c.reserve(maxRows);
+    }
+    for (int rows = 0; (maxRows < 0 || rows < maxRows) && %CPPSELF.next(); ++rows) {
+        for (int c = 0; c < columnCount; ++c)
+            columns[c].append(%CPPSELF.value(c));
+    }
+}
+%END_ALLOW_THREADS
+%PYARG_0 = PyList_New(columnCount);
+for (int c = 0; c < columnCount; ++c) {
+    const QVariantList &values = columns.at(c);
+    PyList_SET_ITEM(%PYARG_0, c, sqlColumnToPython(values, sqlColumnKind(values)));
+}
+// @snippet qsqlquery-fetchcolumns
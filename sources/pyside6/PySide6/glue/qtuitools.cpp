@@ -8,11 +8,15 @@
  */
 
 #include <shiboken.h>
+#include <pysideqobject.h>
 
 #include <QtUiTools/QUiLoader>
 #include <QtWidgets/QWidget>
 #include <QtCore/QFile>
 
+// Dynamic property of the loader enabling lazy child attributes
+static const char lazyChildAttributesProperty[] = "_PySideLazyChildAttributes";
+
 static void createChildrenNameAttributes(PyObject *root, QObject *object)
 {
     for (auto *child : object->children()) {
@@ -24,7 +28,6 @@ static void createChildrenNameAttributes(PyObject *root, QObject *object)
                 Shiboken::AutoDecRef pyChild(%CONVERTTOPYTHON[QObject *](child));
                 PyObject_SetAttr(root, attrName, pyChild);
             }
-            createChildrenNameAttributes(root, child);
         }
         createChildrenNameAttributes(root, child);
     }
@@ -36,7 +39,11 @@ static PyObject *QUiLoadedLoadUiFromDevice(QUiLoader *self, QIODevice *dev, QWid
 
     if (wdg) {
         PyObject *pyWdg = %CONVERTTOPYTHON[QWidget *](wdg);
-        createChildrenNameAttributes(pyWdg, wdg);
+        // Lazy mode: only wrap the children which are accessed from Python
+        if (self->property(lazyChildAttributesProperty).toBool())
+            PySide::setLazyChildAttributes(wdg);
+        else
+            createChildrenNameAttributes(pyWdg, wdg);
         if (parent) {
             Shiboken::AutoDecRef pyParent(%CONVERTTOPYTHON[QWidget *](parent));
             Shiboken::Object::setParent(pyParent, pyWdg);
@@ -76,6 +83,120 @@ auto str = PySide::pyPathToQString(%1);
 %PYARG_0 = QUiLoaderLoadUiFromFileName(%CPPSELF, str, %2);
 // @snippet quiloader-load-2
 
+// @snippet quiloader-setlazychildattributes
+%CPPSELF.setProperty(lazyChildAttributesProperty, %1);
+// @snippet quiloader-setlazychildattributes
+
+// @snippet quiloader-lazychildattributes
+const bool cppResult = %CPPSELF.property(lazyChildAttributesProperty).toBool();
+%PYARG_0 = %CONVERTTOPYTHON[bool](cppResult);
+// @snippet quiloader-lazychildattributes
+
+// @snippet uitools-uic
+#include <QtCore/QCryptographicHash>
+#include <QtCore/QDateTime>
+#include <QtCore/QDir>
+#include <QtCore/QFileInfo>
+#include <QtCore/QHash>
+#include <QtCore/QMutex>
+#include <QtCore/QProcess>
+#include <QtCore/QSaveFile>
+#include <QtCore/QStandardPaths>
+
+#include <optional>
+
+// Use the 'pyside6-uic' wrapper instead of 'uic'
+// This approach is better than rely on 'uic' since installing
+// the wheels cover this case.
+static const char uicBinary[] = "pyside6-uic";
+
+static std::optional<QByteArray> runUic(const QByteArray &uiFileName)
+{
+    QProcess uicProcess;
+    uicProcess.start(QLatin1StringView(uicBinary), {QString::fromUtf8(uiFileName)});
+    if (!uicProcess.waitForFinished()) {
+        qCritical() << "Cannot run 'pyside6-uic': " << uicProcess.errorString() << " - "
+                    << "Exit status " << uicProcess.exitStatus()
+                    << " (" << uicProcess.exitCode() << ")\n"
+                    << "Check if 'pyside6-uic' is in PATH";
+        return std::nullopt;
+    }
+    const QByteArray errorOutput = uicProcess.readAllStandardError();
+    if (!errorOutput.isEmpty()) {
+        qCritical().noquote() << errorOutput;
+        return std::nullopt;
+    }
+    return uicProcess.readAllStandardOutput();
+}
+
+// File in the user's cache directory for the code generated from a .ui file.
+// The name is a hash of the contents and the uic binary. Setting the
+// environment variable PYSIDE6_UIC_CACHE=0 disables it.
+static QString uicCacheFile(const QByteArray &uiContents)
+{
+    if (qEnvironmentVariable("PYSIDE6_UIC_CACHE") == u"0")
+        return {};
+    const QString cacheDir = QStandardPaths::writableLocation(QStandardPaths::GenericCacheLocation);
+    if (cacheDir.isEmpty())
+        return {};
+    QCryptographicHash hash(QCryptographicHash::Sha256);
+    hash.addData(uiContents);
+    hash.addData(QByteArrayView(qVersion()));
+    const QString uicPath = QStandardPaths::findExecutable(QLatin1StringView(uicBinary));
+    if (!uicPath.isEmpty()) {
+        const QFileInfo uicFi(uicPath);
+        hash.addData(QFile::encodeName(uicFi.canonicalFilePath()));
+        hash.addData(QByteArray::number(uicFi.lastModified().toMSecsSinceEpoch()));
+    }
+    return cacheDir + QStringLiteral("/pyside6-uic/")
+        + QString::fromLatin1(hash.result().toHex()) + QStringLiteral(".py");
+}
+
+// Return the Python code generated from a .ui file. It is cached in memory
+// keyed by the contents and on disk, so that only the first load of a form
+// runs pyside6-uic. The memory cache may be accessed from several threads
+// on free-threaded Python builds; uic runs outside of its lock.
+static std::optional<QByteArray> uicGeneratedCode(const QByteArray &uiFileName,
+                                                  const QByteArray &uiContents)
+{
+    static QMutex memoryCacheMutex;
+    static QHash<QByteArray, QByteArray> memoryCache; // guarded by memoryCacheMutex
+    const QByteArray key = QCryptographicHash::hash(uiContents, QCryptographicHash::Sha256);
+    {
+        QMutexLocker locker(&memoryCacheMutex);
+        const auto it = memoryCache.constFind(key);
+        if (it != memoryCache.cend())
+            return it.value();
+    }
+
+    QByteArray code;
+    const QString cacheFileName = uicCacheFile(uiContents);
+    if (!cacheFileName.isEmpty()) {
+        QFile cacheFile(cacheFileName);
+        if (cacheFile.open(QIODevice::ReadOnly))
+            code = cacheFile.readAll();
+    }
+    if (code.isEmpty()) {
+        const auto uicCode = runUic(uiFileName);
+        if (!uicCode.has_value())
+            return std::nullopt;
+        code = uicCode.value();
+        // Several processes may write concurrently
+        if (!cacheFileName.isEmpty()
+            && QDir().mkpath(QFileInfo(cacheFileName).absolutePath())) {
+            QSaveFile cacheFile(cacheFileName);
+            if (cacheFile.open(QIODevice::WriteOnly)) {
+                cacheFile.write(code);
+                cacheFile.commit();
+            }
+        }
+    }
+    QMutexLocker locker(&memoryCacheMutex);
+    memoryCache.insert(key, code);
+    return code;
+}
+// @snippet uitools-uic
+
 // @snippet loaduitype
 /*
 Arguments:
@@ -99,28 +220,15 @@ if (uiFileName.isEmpty()) {
     Py_RETURN_NONE;
 }
 
-// Use the 'pyside6-uic' wrapper instead of 'uic'
-// This approach is better than rely on 'uic' since installing
-// the wheels cover this case.
-QString uicBin("pyside6-uic");
-QStringList uicArgs = {QString::fromUtf8(uiFileName)};
-
-QProcess uicProcess;
-uicProcess.start(uicBin, uicArgs);
-if (!uicProcess.waitForFinished()) {
-    qCritical() << "Cannot run 'pyside6-uic': " << uicProcess.errorString() << " - "
-                << "Exit status " << uicProcess.exitStatus()
-                << " (" << uicProcess.exitCode() << ")\n"
-                << "Check if 'pyside6-uic' is in PATH";
+if (!uiFile.open(QIODevice::ReadOnly))
     Py_RETURN_NONE;
-}
-QByteArray uiFileContent = uicProcess.readAllStandardOutput();
-QByteArray errorOutput = uicProcess.readAllStandardError();
+const QByteArray uiContents = uiFile.readAll();
+uiFile.close();
 
-if (!errorOutput.isEmpty()) {
-    qCritical().noquote() << errorOutput;
+const auto uiFileContentOpt = uicGeneratedCode(uiFileName, uiContents);
+if (!uiFileContentOpt.has_value())
     Py_RETURN_NONE;
-}
+const QByteArray &uiFileContent = uiFileContentOpt.value();
 
 // 2. Obtain the 'classname' and the Qt base class.
 QByteArray className;
@@ -131,14 +239,11 @@ QByteArray baseClassName;
 
 // Solution
 // Use the XML file
-if (!uiFile.open(QIODevice::ReadOnly))
-    Py_RETURN_NONE;
-
 // This will look for the first <widget> tag, e.g.:
 //      <widget class="QWidget" name="ThemeWidgetForm">
 // and then extract the information from "class", and "name",
 // to get the baseClassName and className respectively
-QXmlStreamReader reader(&uiFile);
+QXmlStreamReader reader(uiContents);
 while (!reader.atEnd() && baseClassName.isEmpty() && className.isEmpty()) {
     auto token = reader.readNext();
     if (token == QXmlStreamReader::StartElement && reader.name() == u"widget") {
@@ -147,8 +252,6 @@ while (!reader.atEnd() && baseClassName.isEmpty() && className.isEmpty()) {
     }
 }
 
-uiFile.close();
-
 if (className.isEmpty() || baseClassName.isEmpty() || reader.hasError()) {
     qCritical() << "An error occurred when parsing the UI file while looking for the class info "
                 << reader.errorString();
@@ -0,0 +1,53 @@
+// Copyright (C) 2023 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#ifndef QPYARRAYTABLEMODEL_H
+#define QPYARRAYTABLEMODEL_H
+
+#include <QtCore/QAbstractTableModel>
+
+#include <memory>
+
+struct _object; // PyObject
+
+class QPyArrayTableModelPrivate;
+
+// A table model serving its data from one-dimensional arrays supporting the
+// buffer protocol (numpy arrays, array.array), one per column. Unless a
+// formatter is set for a column, data() reads the values natively without
+// entering the interpreter.
+class QPyArrayTableModel : public QAbstractTableModel
+{
+    Q_OBJECT
+public:
+    Q_DISABLE_COPY_MOVE(QPyArrayTableModel)
+
+    explicit QPyArrayTableModel(QObject *parent = nullptr);
+    ~QPyArrayTableModel() override;
+
+    int rowCount(const QModelIndex &parent = {}) const override;
+    int columnCount(const QModelIndex &parent = {}) const override;
+    QVariant data(const QModelIndex &index, int role = Qt::DisplayRole) const override;
+    QVariant headerData(int section, Qt::Orientation orientation,
+                        int role = Qt::DisplayRole) const override;
+    bool setHeaderData(int section, Qt::Orientation orientation, const QVariant &value,
+                       int role = Qt::EditRole) override;
+    Qt::ItemFlags flags(const QModelIndex &index) const override;
+    bool removeColumns(int column, int count, const QModelIndex &parent = {}) override;
+    void sort(int column, Qt::SortOrder order = Qt::AscendingOrder) override;
+
+    void clear();
+    // Emit dataChanged() after the arrays have been modified in place.
+    void notifyDataChanged(int firstRow = 0, int lastRow = -1);
+
+    // Helpers for the Python API, see typesystem.
+    bool _addColumnHelper(_object *array, const QString &header, _object *formatter);
+    bool _setColumnArrayHelper(int column, _object *array);
+    bool _setColumnFormatterHelper(int column, _object *formatter);
+    _object *_columnArrayHelper(int column) const;
+
+private:
+    std::unique_ptr<QPyArrayTableModelPrivate> d;
+};
+
+#endif // QPYARRAYTABLEMODEL_H
@@ -156,8 +156,30 @@ macro(create_pyside_module)
     list(APPEND shiboken_command "${pyside6_BINARY_DIR}/${module_NAME}_global.h"
          ${typesystem_path})
 
+    # When the generator writes batch source files including the class wrappers,
+    # compile those instead of the wrappers. The batch file names are fixed by their
+    # number, the distribution of the wrappers is determined at generation time.
+    set(module_batch_sources "")
+    if(PYSIDE_UNITY_BATCHES GREATER 0)
+        set(module_wrapper_dir "${CMAKE_CURRENT_BINARY_DIR}/PySide6/${module_NAME}")
+        math(EXPR last_batch "${PYSIDE_UNITY_BATCHES} - 1")
+        foreach(batch RANGE ${last_batch})
+            list(APPEND module_batch_sources
+                 "${module_wrapper_dir}/${lower_module_name}_batch_${batch}.cpp")
+        endforeach()
+        foreach(source ${${module_SOURCES}})
+            get_filename_component(source_dir "${source}" DIRECTORY)
+            if(source_dir STREQUAL module_wrapper_dir AND source MATCHES "_wrapper\\.cpp$"
+               AND NOT source MATCHES "_module_wrapper\\.cpp$")
+                set_source_files_properties(${source} PROPERTIES HEADER_FILE_ONLY ON)
+            endif()
+        endforeach()
+        set_source_files_properties(${module_batch_sources} PROPERTIES
+                                    SKIP_UNITY_BUILD_INCLUSION ON)
+    endif()
+
     add_custom_command( OUTPUT "${CMAKE_CURRENT_BINARY_DIR}/mjb_rejected_classes.log"
-                        BYPRODUCTS ${${module_SOURCES}}
+                        BYPRODUCTS ${${module_SOURCES}} ${module_batch_sources}
                         COMMAND ${shiboken_command}
                         DEPENDS ${total_type_system_files}
                                 ${module_GLUE_SOURCES}
@@ -167,6 +189,7 @@ macro(create_pyside_module)
 
     include_directories(${module_NAME} ${${module_INCLUDE_DIRS}} ${pyside6_SOURCE_DIR})
     add_library(${module_NAME} MODULE ${${module_SOURCES}}
+                                      ${module_batch_sources}
                                       ${${module_STATIC_SOURCES}})
 
     append_size_optimization_flags(${module_NAME})
@@ -99,6 +99,10 @@ add_definitions(${Qt${QT_MAJOR_VERSION}Core_DEFINITIONS})
 
 option(BUILD_TESTS "Build tests." TRUE)
 option(ENABLE_VERSION_SUFFIX "Used to use current version in suffix to generated files. This is used to allow multiples versions installed simultaneous." FALSE)
+option(TYPESYSTEM_SNAPSHOTS "Use snapshots of parsed typesystem files when generating dependent modules." FALSE)
+set(PYSIDE_UNITY_BATCHES "0" CACHE STRING "Number of batch source files per module compiled instead of the class wrappers (0: disabled)")
+option(PYSIDE_CALL_PROFILING "Instrument the wrappers to record call statistics (see Shiboken.callProfile())." FALSE)
+option(PYSIDE_FREE_THREADING "Declare the modules as not using the GIL on free-threaded Python builds." FALSE)
 set(LIB_SUFFIX "" CACHE STRING "Define suffix of directory name (32/64)" )
 set(LIB_INSTALL_DIR "lib${LIB_SUFFIX}" CACHE PATH "The subdirectory relative to the install prefix where libraries will be installed (default is /lib${LIB_SUFFIX})" FORCE)
 if(CMAKE_HOST_APPLE)
@@ -223,6 +227,19 @@ set(GENERATOR_EXTRA_FLAGS --generator-set=shiboken
                           --enable-pyside-extensions
                           --enable-return-value-heuristic
                           --use-isnull-as-nb_nonzero)
+if(TYPESYSTEM_SNAPSHOTS)
+    list(APPEND GENERATOR_EXTRA_FLAGS
+         "--typesystem-snapshots=${CMAKE_CURRENT_BINARY_DIR}/typesystem_snapshots")
+endif()
+if(PYSIDE_UNITY_BATCHES GREATER 0)
+    list(APPEND GENERATOR_EXTRA_FLAGS "--unity-batches=${PYSIDE_UNITY_BATCHES}")
+endif()
+if(PYSIDE_CALL_PROFILING)
+    list(APPEND GENERATOR_EXTRA_FLAGS "--call-profiling")
+endif()
+if(PYSIDE_FREE_THREADING)
+    list(APPEND GENERATOR_EXTRA_FLAGS "--free-threading")
+endif()
 use_protected_as_public_hack()
 
 # Build with Address sanitizer enabled if requested. This may break things, so use at your own risk.
@@ -37,8 +37,10 @@
 #include <QtCore/QCoreApplication>
 #include <QtCore/QDir>
 #include <QtCore/QFileInfo>
+#include <QtCore/QHash>
 #include <QtCore/QMetaMethod>
 #include <QtCore/QMutex>
+#include <QtCore/QPointer>
 #include <QtCore/QStack>
 #include <QtCore/QThread>
 
@@ -52,6 +54,7 @@
 using namespace Qt::StringLiterals;
 
 static QStack<PySide::CleanupFunction> cleanupFunctionList;
+static QMutex cleanupFunctionListMutex;
 static void *qobjectNextAddr;
 
 QT_BEGIN_NAMESPACE
@@ -364,15 +367,22 @@ bool fillQtProperties(PyObject *qObj, const QMetaObject *metaObj,
 
 void registerCleanupFunction(CleanupFunction func)
 {
+    QMutexLocker locker(&cleanupFunctionListMutex);
     cleanupFunctionList.push(func);
 }
 
+static CleanupFunction takeCleanupFunction()
+{
+    QMutexLocker locker(&cleanupFunctionListMutex);
+    return cleanupFunctionList.isEmpty() ? nullptr : cleanupFunctionList.pop();
+}
+
 void runCleanupFunctions()
 {
-    while (!cleanupFunctionList.isEmpty()) {
-        CleanupFunction f = cleanupFunctionList.pop();
+    // The functions are called without holding the lock since they may
+    // register further functions.
+    while (CleanupFunction f = takeCleanupFunction())
         f();
-    }
 }
 
 static void destructionVisitor(SbkObject *pyObj, void *data)
@@ -514,6 +524,65 @@ void initQApp()
     setDestroyQApplication(destroyQCoreApplication);
 }
 
+using ChildNameIndex = QHash<QByteArray, QPointer<QObject>>;
+
+static QHash<const QObject *, ChildNameIndex> &lazyChildIndexes()
+{
+    static QHash<const QObject *, ChildNameIndex> result;
+    return result;
+}
+
+// Protects lazyChildIndexes(); the roots can be destroyed in any thread.
+static QMutex lazyChildIndexesMutex;
+
+static void indexChildren(ChildNameIndex *index, const QObject *object)
+{
+    for (auto *child : object->children()) {
+        const QByteArray name = child->objectName().toLocal8Bit();
+        if (!name.isEmpty() && !name.startsWith('_') && !name.startsWith("qt_")
+            && !index->contains(name)) {
+            index->insert(name, child);
+        }
+        indexChildren(index, child);
+    }
+}
+
+void setLazyChildAttributes(QObject *root)
+{
+    QMutexLocker locker(&lazyChildIndexesMutex);
+    auto &indexes = lazyChildIndexes();
+    auto it = indexes.find(root);
+    if (it == indexes.end()) {
+        it = indexes.insert(root, {});
+        QObject::connect(root, &QObject::destroyed, [root]() {
+            QMutexLocker locker(&lazyChildIndexesMutex);
+            lazyChildIndexes().remove(root);
+        });
+    }
+    it.value().clear();
+    indexChildren(&it.value(), root);
+}
+
+// Returns a new reference to the wrapper of a lazily indexed child or nullptr
+static QObject *lazyChild(const QObject *cppSelf, const char *name)
+{
+    QMutexLocker locker(&lazyChildIndexesMutex);
+    const auto &indexes = lazyChildIndexes();
+    if (indexes.isEmpty())
+        return nullptr;
+    const auto it = indexes.constFind(cppSelf);
+    return it != indexes.cend() ? it.value().value(QByteArray(name)).data() : nullptr;
+}
+
+static PyObject *lazyChildAttribute(const QObject *cppSelf, const char *name)
+{
+    QObject *child = lazyChild(cppSelf, name);
+    if (child == nullptr)
+        return nullptr;
+    PyTypeObject *type = getTypeForQObject(child);
+    return type != nullptr ? getWrapperForQObject(child, type) : nullptr;
+}
+
 PyObject *getHiddenDataFromQObject(QObject *cppSelf, PyObject *self, PyObject *name)
 {
     using Shiboken::AutoDecRef;
@@ -536,6 +605,16 @@ PyObject *getHiddenDataFromQObject(QObject *cppSelf, PyObject *self, PyObject *n
         PyObject *type, *value, *traceback;
         PyErr_Fetch(&type, &value, &traceback);     // This was omitted for a loong time.
 
+        // Named children of a form loaded by QUiLoader. Cache them in the instance
+        // dict like the attributes that are set on loading.
+        if (PyObject *child = lazyChildAttribute(cppSelf, Shiboken::String::toCString(name))) {
+            Py_XDECREF(type);
+            Py_XDECREF(value);
+            Py_XDECREF(traceback);
+            PyObject_SetAttr(self, name, child);
+            return child;
+        }
+
         int flags = currentSelectId(Py_TYPE(self));
         int snake_flag = flags & 0x01;
         int propFlag = flags & 0x02;
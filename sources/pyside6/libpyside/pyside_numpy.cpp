@@ -4,6 +4,11 @@
 #include "pyside_numpy.h"
 #include <sbknumpyview.h>
 
+#include <QtCore/QFloat16>
+
+#include <cstring>
+#include <vector>
+
 // Convert X,Y of type T data to a list of points (QPoint, PointF)
 template <class T, class Point>
 static QList<Point>
@@ -32,6 +37,112 @@ static QList<QPoint>
     return result;
 }
 
+// Create a list of values from the rows of a strided 2-dimensional array
+// of type T, passing an accessor for the columns to the factory
+template <class T, class Value, class Factory>
+static QList<Value> rowDataToListHelper(const Shiboken::Numpy::View &v, Factory factory)
+{
+    QList<Value> result;
+    const qsizetype rows = v.dimensions[0];
+    result.reserve(rows);
+    auto *row = reinterpret_cast<const char *>(v.data);
+    for (qsizetype r = 0; r < rows; ++r, row += v.stride[0]) {
+        auto at = [row, &v](qsizetype c) {
+            return qreal(*reinterpret_cast<const T *>(row + c * v.stride[1]));
+        };
+        result.append(factory(at));
+    }
+    return result;
+}
+
+static const char unsupportedArrayMessage[] =
+    "An aligned numpy array of integer or floating point type is expected.";
+
+template <class Value, class Factory>
+static QList<Value> rowDataToList(PyObject *pyIn, Py_ssize_t columns, Factory factory)
+{
+    using Shiboken::Numpy::View;
+    const auto v = View::fromPyObject(pyIn, View::Layout::Strided);
+    if (!v) {
+        PyErr_SetString(PyExc_TypeError, unsupportedArrayMessage);
+        return {};
+    }
+    if (v.ndim != 2 || v.dimensions[1] != columns) {
+        PyErr_Format(PyExc_ValueError, "An array of shape (N, %zd) is expected.", columns);
+        return {};
+    }
+    if (v.dimensions[0] == 0)
+        return {};
+    switch (v.type) {
+    case View::Int16:
+        return rowDataToListHelper<int16_t, Value>(v, factory);
+    case View::Unsigned16:
+        return rowDataToListHelper<uint16_t, Value>(v, factory);
+    case View::Int:
+        return rowDataToListHelper<int, Value>(v, factory);
+    case View::Unsigned:
+        return rowDataToListHelper<unsigned, Value>(v, factory);
+    case View::Int64:
+        return rowDataToListHelper<int64_t, Value>(v, factory);
+    case View::Unsigned64:
+        return rowDataToListHelper<uint64_t, Value>(v, factory);
+    case View::Float:
+        return rowDataToListHelper<float, Value>(v, factory);
+    case View::Double:
+        break;
+    }
+    return rowDataToListHelper<double, Value>(v, factory);
+}
+
+template <class T>
+static QList<unsigned> uintDataToListHelper(const Shiboken::Numpy::View &v)
+{
+    QList<unsigned> result;
+    const qsizetype size = v.dimensions[0];
+    result.reserve(size);
+    auto *data = reinterpret_cast<const char *>(v.data);
+    for (qsizetype i = 0; i < size; ++i, data += v.stride[0])
+        result.append(unsigned(*reinterpret_cast<const T *>(data)));
+    return result;
+}
+
+// The data are copied since the buffer items need not be aligned.
+template <class T>
+static inline T loadBufferItem(const char *p)
+{
+    T result;
+    std::memcpy(&result, p, sizeof(T));
+    return result;
+}
+
+static QString ucs4BufferItemToString(const char *p, Py_ssize_t itemSize)
+{
+    const Py_ssize_t maxSize = itemSize / Py_ssize_t(sizeof(char32_t));
+    std::vector<char32_t> buffer(maxSize);
+    std::memcpy(buffer.data(), p, itemSize);
+    Py_ssize_t size = maxSize;
+    while (size > 0 && buffer[size - 1] == 0)
+        --size;
+    return QString::fromUcs4(buffer.data(), size);
+}
+
+// Acquire a strided buffer of the given dimensions and a supported type,
+// returns false without setting an error otherwise.
+static bool acquireBuffer(PyObject *pyIn, int ndim, Py_buffer *view)
+{
+    if (PyObject_CheckBuffer(pyIn) == 0)
+        return false;
+    if (PyObject_GetBuffer(pyIn, view, PyBUF_RECORDS_RO) != 0) {
+        PyErr_Clear();
+        return false;
+    }
+    if (view->ndim != ndim || !PySide::Numpy::bufferType(*view).has_value()) {
+        PyBuffer_Release(view);
+        return false;
+    }
+    return true;
+}
+
 namespace PySide::Numpy
 {
 
@@ -95,4 +206,179 @@ QList<QPoint> xyDataToQPointList(PyObject *pyXIn, PyObject *pyYIn)
     return xyFloatDataToQPointHelper<double>(xv.data, yv.data, size);
 }
 
+QList<QPointF> pointArrayToQPointFList(PyObject *pyIn)
+{
+    return rowDataToList<QPointF>(pyIn, 2, [](auto at) {
+        return QPointF(at(0), at(1));
+    });
+}
+
+QList<QLineF> lineArrayToQLineFList(PyObject *pyIn)
+{
+    return rowDataToList<QLineF>(pyIn, 4, [](auto at) {
+        return QLineF(at(0), at(1), at(2), at(3));
+    });
+}
+
+QList<QRectF> rectArrayToQRectFList(PyObject *pyIn)
+{
+    return rowDataToList<QRectF>(pyIn, 4, [](auto at) {
+        return QRectF(at(0), at(1), at(2), at(3));
+    });
+}
+
+QList<unsigned> uintArrayToList(PyObject *pyIn)
+{
+    using Shiboken::Numpy::View;
+    const auto v = View::fromPyObject(pyIn, View::Layout::Strided);
+    if (!v) {
+        PyErr_SetString(PyExc_TypeError, unsupportedArrayMessage);
+        return {};
+    }
+    if (v.ndim != 1) {
+        PyErr_SetString(PyExc_ValueError, "A one-dimensional array is expected.");
+        return {};
+    }
+    switch (v.type) {
+    case View::Int:
+        return uintDataToListHelper<int>(v);
+    case View::Unsigned:
+        return uintDataToListHelper<unsigned>(v);
+    case View::Int64:
+        return uintDataToListHelper<int64_t>(v);
+    case View::Unsigned64:
+        return uintDataToListHelper<uint64_t>(v);
+    default:
+        break;
+    }
+    PyErr_SetString(PyExc_TypeError, "An array of 32 or 64-bit integers is expected.");
+    return {};
+}
+
+std::optional<BufferType> bufferType(const Py_buffer &view)
+{
+    const char *format = view.format != nullptr ? view.format : "B";
+    switch (*format) { // Native byte order only
+    case '@':
+    case '=':
+#if Q_BYTE_ORDER == Q_LITTLE_ENDIAN
+    case '<':
+#else
+    case '>':
+    case '!':
+#endif
+        ++format;
+        break;
+    default:
+        break;
+    }
+    while (*format >= '0' && *format <= '9') // Repeat count of strings
+        ++format;
+    if (format[0] == '\0' || format[1] != '\0')
+        return {};
+
+    const bool isSigned = std::strchr("bhilqn", format[0]) != nullptr;
+    const bool isUnsigned = std::strchr("BHILQN", format[0]) != nullptr;
+    if (isSigned || isUnsigned) {
+        switch (view.itemsize) {
+        case 1:
+            return isSigned ? BufferType::Int8 : BufferType::UInt8;
+        case 2:
+            return isSigned ? BufferType::Int16 : BufferType::UInt16;
+        case 4:
+            return isSigned ? BufferType::Int32 : BufferType::UInt32;
+        case 8:
+            return isSigned ? BufferType::Int64 : BufferType::UInt64;
+        default:
+            return {};
+        }
+    }
+    switch (format[0]) {
+    case 'e':
+        return BufferType::Half;
+    case 'f':
+        return BufferType::Float;
+    case 'd':
+        return BufferType::Double;
+    case '?':
+        return BufferType::Bool;
+    case 's':
+        return BufferType::Bytes;
+    case 'w':
+        return view.itemsize % 4 == 0 ? std::optional(BufferType::Ucs4) : std::nullopt;
+    default:
+        break;
+    }
+    return {};
+}
+
+QVariant bufferItemToVariant(BufferType type, const char *p, Py_ssize_t itemSize)
+{
+    switch (type) {
+    case BufferType::Int8:
+        return QVariant(int(loadBufferItem<qint8>(p)));
+    case BufferType::UInt8:
+        return QVariant(uint(loadBufferItem<quint8>(p)));
+    case BufferType::Int16:
+        return QVariant(int(loadBufferItem<qint16>(p)));
+    case BufferType::UInt16:
+        return QVariant(uint(loadBufferItem<quint16>(p)));
+    case BufferType::Int32:
+        return QVariant(loadBufferItem<qint32>(p));
+    case BufferType::UInt32:
+        return QVariant(loadBufferItem<quint32>(p));
+    case BufferType::Int64:
+        return QVariant(qlonglong(loadBufferItem<qint64>(p)));
+    case BufferType::UInt64:
+        return QVariant(qulonglong(loadBufferItem<quint64>(p)));
+    case BufferType::Half:
+        return QVariant(float(loadBufferItem<qfloat16>(p)));
+    case BufferType::Float:
+        return QVariant(loadBufferItem<float>(p));
+    case BufferType::Double:
+        return QVariant(loadBufferItem<double>(p));
+    case BufferType::Bool:
+        return QVariant(loadBufferItem<quint8>(p) != 0);
+    case BufferType::Bytes:
+        return QString::fromUtf8(p, qsizetype(qstrnlen(p, uint(itemSize))));
+    case BufferType::Ucs4:
+        return ucs4BufferItemToString(p, itemSize);
+    }
+    return {};
+}
+
+std::optional<QVariantList> arrayToVariantList(PyObject *pyIn)
+{
+    Py_buffer view;
+    if (!acquireBuffer(pyIn, 1, &view))
+        return std::nullopt;
+    const BufferType type = bufferType(view).value();
+    QVariantList result;
+    result.reserve(view.shape[0]);
+    const auto *item = static_cast<const char *>(view.buf);
+    for (Py_ssize_t i = 0; i < view.shape[0]; ++i, item += view.strides[0])
+        result.append(bufferItemToVariant(type, item, view.itemsize));
+    PyBuffer_Release(&view);
+    return result;
+}
+
+std::optional<QList<QVariantList>> arrayToVariantRows(PyObject *pyIn)
+{
+    Py_buffer view;
+    if (!acquireBuffer(pyIn, 2, &view))
+        return std::nullopt;
+    const BufferType type = bufferType(view).value();
+    QList<QVariantList> result(view.shape[0]);
+    const auto *row = static_cast<const char *>(view.buf);
+    for (auto &values : result) {
+        values.reserve(view.shape[1]);
+        const char *item = row;
+        for (Py_ssize_t c = 0; c < view.shape[1]; ++c, item += view.strides[1])
+            values.append(bufferItemToVariant(type, item, view.itemsize));
+        row += view.strides[0];
+    }
+    PyBuffer_Release(&view);
+    return result;
+}
+
 } //namespace PySide::Numpy
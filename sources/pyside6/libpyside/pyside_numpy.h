@@ -9,9 +9,14 @@
 
 #include <pysidemacros.h>
 
+#include <QtCore/QLine>
 #include <QtCore/QList>
 #include <QtCore/QPoint>
 #include <QtCore/QPointF>
+#include <QtCore/QRect>
+#include <QtCore/QVariant>
+
+#include <optional>
 
 namespace PySide::Numpy
 {
@@ -32,6 +37,79 @@ PYSIDE_API QList<QPointF> xyDataToQPointFList(PyObject *pyXIn, PyObject *pyYIn);
 
 PYSIDE_API QList<QPoint> xyDataToQPointList(PyObject *pyXIn, PyObject *pyYIn);
 
+/// Create a list of QPointF from a numpy array of shape (N, 2) of x, y
+/// values (integer, float, double). The array may be strided.
+/// Sets a Python error if the array has the wrong type or shape.
+/// \param pyIn Data array
+/// \return List of QPointF
+
+PYSIDE_API QList<QPointF> pointArrayToQPointFList(PyObject *pyIn);
+
+/// Create a list of QLineF from a numpy array of shape (N, 4) of x1, y1,
+/// x2, y2 values (integer, float, double). The array may be strided.
+/// Sets a Python error if the array has the wrong type or shape.
+/// \param pyIn Data array
+/// \return List of QLineF
+
+PYSIDE_API QList<QLineF> lineArrayToQLineFList(PyObject *pyIn);
+
+/// Create a list of QRectF from a numpy array of shape (N, 4) of x, y,
+/// width, height values (integer, float, double). The array may be strided.
+/// Sets a Python error if the array has the wrong type or shape.
+/// \param pyIn Data array
+/// \return List of QRectF
+
+PYSIDE_API QList<QRectF> rectArrayToQRectFList(PyObject *pyIn);
+
+/// Create a list of unsigned values from a one-dimensional numpy array of
+/// (unsigned) integers, for example QRgb values. The array may be strided.
+/// Sets a Python error if the array has the wrong type or shape.
+/// \param pyIn Data array
+/// \return List of values
+
+PYSIDE_API QList<unsigned> uintArrayToList(PyObject *pyIn);
+
+/// Element type of an array supporting the buffer protocol in native byte
+/// order (struct module format syntax).
+enum class BufferType
+{
+    Int8, UInt8, Int16, UInt16, Int32, UInt32, Int64, UInt64,
+    Half, Float, Double, Bool,
+    Bytes, // Fixed size, zero padded UTF-8 ("10s")
+    Ucs4   // Fixed size, zero padded UCS4 ("10w", numpy 'U')
+};
+
+/// Determine the element type of a buffer obtained with PyBUF_FORMAT.
+/// \param view Buffer
+/// \return Element type or nullopt if the format is not supported
+
+PYSIDE_API std::optional<BufferType> bufferType(const Py_buffer &view);
+
+/// Convert an item of a buffer to a QVariant.
+/// \param type Element type of the buffer
+/// \param item Pointer to the item, need not be aligned
+/// \param itemSize Item size of the buffer
+/// \return Value
+
+PYSIDE_API QVariant bufferItemToVariant(BufferType type, const char *item,
+                                        Py_ssize_t itemSize);
+
+/// Create a list of QVariant from a one-dimensional array supporting the
+/// buffer protocol. The array may be strided.
+/// \param pyIn Data array
+/// \return List of values or nullopt if \a pyIn is not a one-dimensional
+///         array of a supported type
+
+PYSIDE_API std::optional<QVariantList> arrayToVariantList(PyObject *pyIn);
+
+/// Create a list of rows of QVariant from a two-dimensional array supporting
+/// the buffer protocol. The array may be strided.
+/// \param pyIn Data array
+/// \return List of rows or nullopt if \a pyIn is not a two-dimensional
+///         array of a supported type
+
+PYSIDE_API std::optional<QList<QVariantList>> arrayToVariantRows(PyObject *pyIn);
+
 } //namespace PySide::Numpy
 
 #endif // PYSIDE_NUMPY_H
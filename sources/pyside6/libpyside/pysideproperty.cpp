@@ -10,6 +10,8 @@
 #include <shiboken.h>
 #include <signature.h>
 
+#include <limits>
+
 using namespace Shiboken;
 
 extern "C"
@@ -133,6 +135,84 @@ int PySidePropertyPrivate::reset(PyObject *source)
     return -1;
 }
 
+// Resolve the converter for the type name, which is a string-keyed lookup
+// in the converter registry. Done once and repeated only when the type name
+// changes. Returns a copy of the cached converter, or nothing for unknown
+// types. The cache is guarded by a mutex since properties may be accessed
+// from several threads concurrently on free-threaded Python builds.
+std::optional<Conversions::SpecificConverter>
+    PySidePropertyPrivate::cachedConverter(PrimitiveType *primitive)
+{
+    QMutexLocker locker(&converterMutex);
+    if (!converter.has_value() || converterTypeName != typeName) {
+        Conversions::SpecificConverter specificConverter(typeName);
+        if (!specificConverter)
+            return std::nullopt;
+        converter = specificConverter;
+        converterTypeName = typeName;
+        if (typeName == "int")
+            primitiveType = PrimitiveType::Int;
+        else if (typeName == "double")
+            primitiveType = PrimitiveType::Double;
+        else if (typeName == "bool")
+            primitiveType = PrimitiveType::Bool;
+        else
+            primitiveType = PrimitiveType::None;
+    }
+    *primitive = primitiveType;
+    return converter;
+}
+
+// Fast paths for the most common primitive types
+static bool primitiveToCpp(PySidePropertyPrivate::PrimitiveType type,
+                           PyObject *pyIn, void *cppOut)
+{
+    switch (type) {
+    case PySidePropertyPrivate::PrimitiveType::Int:
+        if (PyLong_CheckExact(pyIn)) {
+            int overflow = 0;
+            const long value = PyLong_AsLongAndOverflow(pyIn, &overflow);
+            if (overflow == 0 && value >= std::numeric_limits<int>::min()
+                && value <= std::numeric_limits<int>::max()) {
+                *reinterpret_cast<int *>(cppOut) = int(value);
+                return true;
+            }
+        }
+        break;
+    case PySidePropertyPrivate::PrimitiveType::Double:
+        if (PyFloat_CheckExact(pyIn)) {
+            *reinterpret_cast<double *>(cppOut) = PyFloat_AsDouble(pyIn);
+            return true;
+        }
+        break;
+    case PySidePropertyPrivate::PrimitiveType::Bool:
+        if (PyBool_Check(pyIn)) {
+            *reinterpret_cast<bool *>(cppOut) = pyIn == Py_True;
+            return true;
+        }
+        break;
+    case PySidePropertyPrivate::PrimitiveType::None:
+        break;
+    }
+    return false;
+}
+
+static PyObject *primitiveToPython(PySidePropertyPrivate::PrimitiveType type,
+                                   const void *cppIn)
+{
+    switch (type) {
+    case PySidePropertyPrivate::PrimitiveType::Int:
+        return PyLong_FromLong(*reinterpret_cast<const int *>(cppIn));
+    case PySidePropertyPrivate::PrimitiveType::Double:
+        return PyFloat_FromDouble(*reinterpret_cast<const double *>(cppIn));
+    case PySidePropertyPrivate::PrimitiveType::Bool:
+        return PyBool_FromLong(*reinterpret_cast<const bool *>(cppIn) ? 1 : 0);
+    case PySidePropertyPrivate::PrimitiveType::None:
+        break;
+    }
+    return nullptr;
+}
+
 void PySidePropertyPrivate::metaCall(PyObject *source, QMetaObject::Call call, void **args)
 {
     switch (call) {
@@ -140,9 +220,10 @@ void PySidePropertyPrivate::metaCall(PyObject *source, QMetaObject::Call call, v
         AutoDecRef value(getValue(source));
         auto *obValue = value.object();
         if (obValue) {
-            Conversions::SpecificConverter converter(typeName);
-            if (converter) {
-                converter.toCpp(obValue, args[0]);
+            PrimitiveType primitive{};
+            if (auto specificConverter = cachedConverter(&primitive)) {
+                if (!primitiveToCpp(primitive, obValue, args[0]))
+                    specificConverter->toCpp(obValue, args[0]);
             } else {
                 // PYSIDE-2160: Report an unknown type name to the caller `qtPropertyMetacall`.
                 PyErr_SetObject(PyExc_StopIteration, obValue);
@@ -152,9 +233,10 @@ void PySidePropertyPrivate::metaCall(PyObject *source, QMetaObject::Call call, v
         break;
 
     case QMetaObject::WriteProperty: {
-        Conversions::SpecificConverter converter(typeName);
-        if (converter) {
-            AutoDecRef value(converter.toPython(args[0]));
+        PrimitiveType primitive{};
+        if (auto specificConverter = cachedConverter(&primitive)) {
+            PyObject *obValue = primitiveToPython(primitive, args[0]);
+            AutoDecRef value(obValue != nullptr ? obValue : specificConverter->toPython(args[0]));
             setValue(source, value);
         } else {
             // PYSIDE-2160: Report an unknown type name to the caller `qtPropertyMetacall`.
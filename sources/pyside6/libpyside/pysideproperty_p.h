@@ -9,8 +9,13 @@
 #include "pysideproperty.h"
 #include <pysidemacros.h>
 
+#include <sbkconverter.h>
+
 #include <QtCore/QByteArray>
 #include <QtCore/QMetaObject>
+#include <QtCore/QMutex>
+
+#include <optional>
 
 struct PySideProperty;
 
@@ -21,10 +26,16 @@ public:
 
     virtual void metaCall(PyObject *source, QMetaObject::Call call, void **args);
 
-    PyObject *getValue(PyObject *source);
-    int setValue(PyObject *source, PyObject *value);
+    virtual PyObject *getValue(PyObject *source);
+    virtual int setValue(PyObject *source, PyObject *value);
     int reset(PyObject *source);
 
+    // Primitive types for which metaCall() bypasses the converters
+    enum class PrimitiveType { None, Int, Double, Bool };
+
+    std::optional<Shiboken::Conversions::SpecificConverter>
+        cachedConverter(PrimitiveType *primitive);
+
     QByteArray typeName;
     // Type object: A real PyTypeObject ("@Property(int)") or a string
     // "@Property('QVariant')".
@@ -43,6 +54,12 @@ public:
     bool user = false;
     bool constant = false;
     bool final = false;
+    // Conversion cache for metaCall(), refreshed by cachedConverter()
+    // when typeName changes, guarded by converterMutex.
+    QMutex converterMutex;
+    QByteArray converterTypeName;
+    std::optional<Shiboken::Conversions::SpecificConverter> converter;
+    PrimitiveType primitiveType = PrimitiveType::None;
 };
 
 namespace PySide { namespace Property {
@@ -50,6 +50,14 @@ PYSIDE_API QObject *convertToQObject(PyObject *object, bool raiseError);
 /// method pulled out of a Python property.
 PYSIDE_API PyObject *getHiddenDataFromQObject(QObject *cppSelf, PyObject *self, PyObject *name);
 
+/// Index the named descendants of \p root so that they are resolved as
+/// attributes of its Python object on first access by getHiddenDataFromQObject()
+/// instead of creating wrappers for all of them upfront (QUiLoader).
+/// Names starting with '_' or "qt_" are excluded; for duplicated names, the
+/// first object in depth-first order is used.
+/// \param root QObject whose descendants are indexed
+PYSIDE_API void setLazyChildAttributes(QObject *root);
+
 /// Mutex for accessing QObject memory helpers from multiple threads
 PYSIDE_API QMutex &nextQObjectMemoryAddrMutex();
 PYSIDE_API void *nextQObjectMemoryAddr();
@@ -430,10 +430,11 @@ static PyObject *signalInstanceConnect(PyObject *self, PyObject *args, PyObject
 {
     PyObject *slot = nullptr;
     PyObject *type = nullptr;
-    static const char *kwlist[] = {"slot", "type", nullptr};
+    int coalesce = 0;
+    static const char *kwlist[] = {"slot", "type", "coalesce", nullptr};
 
     if (!PyArg_ParseTupleAndKeywords(args, kwds,
-        "O|O:SignalInstance", const_cast<char **>(kwlist), &slot, &type))
+        "O|Op:SignalInstance", const_cast<char **>(kwlist), &slot, &type, &coalesce))
         return nullptr;
 
     PySideSignalInstance *source = reinterpret_cast<PySideSignalInstance *>(self);
@@ -445,11 +446,15 @@ static PyObject *signalInstanceConnect(PyObject *self, PyObject *args, PyObject
         PyErr_Format(PyExc_RuntimeError, "Signal source has been deleted");
         return nullptr;
     }
-
     Shiboken::AutoDecRef pyArgs(PyList_New(0));
 
     bool match = false;
     if (Py_TYPE(slot) == PySideSignalInstance_TypeF()) {
+        if (coalesce != 0) {
+            PyErr_SetString(PyExc_TypeError,
+                            "Coalesced connections require a callable receiver.");
+            return nullptr;
+        }
         PySideSignalInstance *sourceWalk = source;
 
         //find best match
@@ -537,13 +542,16 @@ static PyObject *signalInstanceConnect(PyObject *self, PyObject *args, PyObject
 
     if (match) {
         Shiboken::AutoDecRef tupleArgs(PyList_AsTuple(pyArgs));
+        Shiboken::AutoDecRef connectKwds(coalesce != 0 ? PyDict_New() : nullptr);
+        if (!connectKwds.isNull())
+            PyDict_SetItemString(connectKwds, "coalesce", Py_True);
         Shiboken::AutoDecRef pyMethod(PyObject_GetAttr(source->d->source,
                                                        PySide::PySideName::qtConnect()));
         if (pyMethod.isNull()) { // PYSIDE-79: check if pyMethod exists.
             PyErr_SetString(PyExc_RuntimeError, "method 'connect' vanished!");
             return nullptr;
         }
-        PyObject *result = PyObject_CallObject(pyMethod, tupleArgs);
+        PyObject *result = PyObject_Call(pyMethod, tupleArgs, connectKwds);
         if (connection_Check(result))
             return result;
         Py_XDECREF(result);
@@ -826,7 +834,8 @@ static const char *Signal_SignatureStrings[] = {
     nullptr}; // Sentinel
 
 static const char *SignalInstance_SignatureStrings[] = {
-    "PySide6.QtCore.SignalInstance.connect(self,slot:object,type:type=nullptr)",
+    "PySide6.QtCore.SignalInstance.connect(self,slot:object,type:type=nullptr,"
+        "coalesce:bool=False)",
     "PySide6.QtCore.SignalInstance.disconnect(self,slot:object=nullptr)",
     "PySide6.QtCore.SignalInstance.emit(self,*args:typing.Any)",
     nullptr}; // Sentinel
@@ -11,9 +11,18 @@
 #include "basewrapper.h"
 #include "autodecref.h"
 
+#include <QtCore/QCoreApplication>
 #include <QtCore/QDebug>
+#include <QtCore/QEvent>
 #include <QtCore/QMetaMethod>
+#include <QtCore/QMutex>
 #include <QtCore/QObject>
+#include <QtCore/QPointer>
+#include <QtCore/QVariant>
+#include <QtCore/QVarLengthArray>
+
+#include <algorithm>
+#include <utility>
 
 static bool isMethodDecorator(PyObject *method, bool is_pymethod, PyObject *self)
 {
@@ -133,6 +142,245 @@ static GetReceiverResult getReceiver(QObject *source, const char *signal,
     return result;
 }
 
+
+// A helper for coalesced connections. The signal is connected directly to
+// the relay, which stores a copy of the newest arguments and posts a single
+// event to itself (living in the receiver's thread) per batch of emissions.
+// When the event is processed, the slot is invoked with the newest arguments.
+// The relays are not children of the receiver (which would expose them in
+// QObject::children()), but are kept in a registry. They are released when
+// the connection is disconnected or either end is destroyed.
+class CoalescingRelay : public QObject
+{
+public:
+    explicit CoalescingRelay(const QObject *source, const QMetaMethod &signal,
+                             QObject *receiver, int slotIndex);
+
+    int qt_metacall(QMetaObject::Call call, int id, void **args) override;
+    bool event(QEvent *e) override;
+
+    static int relayMethodIndex() { return QObject::staticMetaObject.methodCount(); }
+
+    /// Connect the source's signal to a new relay and register it.
+    static QMetaObject::Connection connect(QObject *source, int signalIndex,
+                                           QObject *receiver, int slotIndex);
+
+    /// Remove the relay matching the connection from the registry and
+    /// release it. Returns false if there is none.
+    static bool release(const QObject *source, int signalIndex,
+                        const QObject *receiver, int slotIndex);
+
+    /// Release the relays whose connection to the source was severed by
+    /// QObject::disconnect(QMetaObject::Connection).
+    static void releaseDisconnected();
+
+private:
+    static QEvent::Type deliveryEventType();
+
+    static bool unregister(CoalescingRelay *relay);
+    static void unregisterAndRelease(CoalescingRelay *relay);
+
+    bool matches(const QObject *source, int signalIndex,
+                 const QObject *receiver, int slotIndex) const
+    {
+        return m_source == source && m_signalIndex == signalIndex
+               && m_receiver.data() == receiver && m_slotIndex == slotIndex;
+    }
+
+    bool isConnected() const { return bool(m_connection); }
+
+    // Disconnect from the source and schedule deletion, dropping pending
+    // deliveries. Only called by the caller that removed the relay from the
+    // registry, so that it runs once.
+    void dispose();
+
+    void store(void **args);
+    void deliver();
+
+    const QObject *m_source; // guarded by the registry mutex
+    const int m_signalIndex;
+    const int m_slotIndex;
+    QList<QMetaType> m_parameterTypes;
+    QPointer<QObject> m_receiver;
+    QMetaObject::Connection m_connection;
+
+    QMutex m_mutex;
+    QVariantList m_pending; // guarded by m_mutex
+    bool m_posted = false; // guarded by m_mutex
+    bool m_released = false; // guarded by m_mutex
+};
+
+static QMutex relayRegistryMutex;
+static QList<CoalescingRelay *> relayRegistry; // guarded by relayRegistryMutex
+
+CoalescingRelay::CoalescingRelay(const QObject *source, const QMetaMethod &signal,
+                                 QObject *receiver, int slotIndex) :
+    m_source(source),
+    m_signalIndex(signal.methodIndex()),
+    m_slotIndex(slotIndex),
+    m_receiver(receiver)
+{
+    const int parameterCount = signal.parameterCount();
+    m_parameterTypes.reserve(parameterCount);
+    for (int i = 0; i < parameterCount; ++i)
+        m_parameterTypes.append(signal.parameterMetaType(i));
+}
+
+QEvent::Type CoalescingRelay::deliveryEventType()
+{
+    static const auto result = static_cast<QEvent::Type>(QEvent::registerEventType());
+    return result;
+}
+
+QMetaObject::Connection CoalescingRelay::connect(QObject *source, int signalIndex,
+                                                 QObject *receiver, int slotIndex)
+{
+    auto *relay = new CoalescingRelay(source, source->metaObject()->method(signalIndex),
+                                      receiver, slotIndex);
+    if (relay->thread() != receiver->thread())
+        relay->moveToThread(receiver->thread());
+    relay->m_connection = QMetaObject::connect(source, signalIndex, relay, relayMethodIndex(),
+                                               Qt::DirectConnection);
+    if (!relay->m_connection) {
+        delete relay;
+        return {};
+    }
+
+    {
+        QMutexLocker locker(&relayRegistryMutex);
+        relayRegistry.append(relay);
+    }
+    // The destroyed() signals may be emitted from any thread; the registry
+    // decides which caller releases the relay.
+    auto onDestroyed = [relay]() { unregisterAndRelease(relay); };
+    QObject::connect(source, &QObject::destroyed, relay, onDestroyed, Qt::DirectConnection);
+    QObject::connect(receiver, &QObject::destroyed, relay, onDestroyed, Qt::DirectConnection);
+    return relay->m_connection;
+}
+
+bool CoalescingRelay::unregister(CoalescingRelay *relay)
+{
+    QMutexLocker locker(&relayRegistryMutex);
+    if (!relayRegistry.removeOne(relay))
+        return false;
+    relay->m_source = nullptr;
+    return true;
+}
+
+void CoalescingRelay::unregisterAndRelease(CoalescingRelay *relay)
+{
+    if (unregister(relay))
+        relay->dispose();
+}
+
+bool CoalescingRelay::release(const QObject *source, int signalIndex,
+                              const QObject *receiver, int slotIndex)
+{
+    CoalescingRelay *relay = nullptr;
+    {
+        QMutexLocker locker(&relayRegistryMutex);
+        auto pred = [=](const CoalescingRelay *r) {
+            return r->matches(source, signalIndex, receiver, slotIndex);
+        };
+        auto it = std::find_if(relayRegistry.begin(), relayRegistry.end(), pred);
+        if (it == relayRegistry.end())
+            return false;
+        relay = *it;
+        relay->m_source = nullptr;
+        relayRegistry.erase(it);
+    }
+    relay->dispose();
+    return true;
+}
+
+void CoalescingRelay::releaseDisconnected()
+{
+    QList<CoalescingRelay *> disconnected;
+    {
+        QMutexLocker locker(&relayRegistryMutex);
+        for (auto it = relayRegistry.begin(); it != relayRegistry.end(); ) {
+            if ((*it)->isConnected()) {
+                ++it;
+            } else {
+                (*it)->m_source = nullptr;
+                disconnected.append(*it);
+                it = relayRegistry.erase(it);
+            }
+        }
+    }
+    for (auto *relay : std::as_const(disconnected))
+        relay->dispose();
+}
+
+void CoalescingRelay::dispose()
+{
+    QObject::disconnect(m_connection);
+    {
+        QMutexLocker locker(&m_mutex);
+        m_released = true;
+        m_pending.clear();
+    }
+    deleteLater();
+}
+
+int CoalescingRelay::qt_metacall(QMetaObject::Call call, int id, void **args)
+{
+    id = QObject::qt_metacall(call, id, args);
+    if (id < 0 || call != QMetaObject::InvokeMetaMethod)
+        return id;
+    if (id == 0)
+        store(args);
+    return -1;
+}
+
+// Called from the thread emitting the signal.
+void CoalescingRelay::store(void **args)
+{
+    QVariantList values;
+    values.reserve(m_parameterTypes.size());
+    for (qsizetype i = 0, size = m_parameterTypes.size(); i < size; ++i)
+        values.append(QVariant(m_parameterTypes.at(i), args[i + 1]));
+
+    bool post = false;
+    {
+        QMutexLocker locker(&m_mutex);
+        m_pending.swap(values); // Older pending values are destroyed outside the lock
+        post = !std::exchange(m_posted, true);
+    }
+    if (post)
+        QCoreApplication::postEvent(this, new QEvent(deliveryEventType()));
+}
+
+bool CoalescingRelay::event(QEvent *e)
+{
+    if (e->type() != deliveryEventType())
+        return QObject::event(e);
+    deliver();
+    return true;
+}
+
+// Called from the receiver's thread.
+void CoalescingRelay::deliver()
+{
+    QVariantList values;
+    {
+        QMutexLocker locker(&m_mutex);
+        values.swap(m_pending);
+        m_posted = false;
+        if (m_released)
+            return;
+    }
+    if (m_receiver.isNull() || values.size() != m_parameterTypes.size())
+        return;
+
+    QVarLengthArray<void *, 8> args(values.size() + 1);
+    args[0] = nullptr;
+    for (qsizetype i = 0, size = values.size(); i < size; ++i)
+        args[i + 1] = values[i].data();
+    QMetaObject::metacall(m_receiver.data(), QMetaObject::InvokeMetaMethod,
+                          m_slotIndex, args.data());
+}
+
 namespace PySide
 {
 class FriendlyQObject : public QObject // Make protected connectNotify() accessible.
@@ -166,12 +414,20 @@ QMetaObject::Connection qobjectConnect(QObject *source, QMetaMethod signal,
                           receiver, slot.methodSignature().constData(), type);
 }
 
-QMetaObject::Connection qobjectConnectCallback(QObject *source, const char *signal,
-                                               PyObject *callback, Qt::ConnectionType type)
+static QMetaObject::Connection connectCallback(QObject *source, const char *signal,
+                                               PyObject *callback, Qt::ConnectionType type,
+                                               bool coalesce)
 {
     if (!signal || !PySide::Signal::checkQtSignal(signal))
         return {};
 
+    if (coalesce && (type == Qt::DirectConnection || type == Qt::BlockingQueuedConnection)) {
+        PyErr_SetString(PyExc_ValueError,
+                        "Coalesced connections are always queued; direct and blocking "
+                        "queued connection types are not supported.");
+        return {};
+    }
+
     const int signalIndex =
         PySide::SignalManager::registerMetaMethodGetIndex(source, signal + 1,
                                                           QMetaMethod::Signal);
@@ -210,7 +466,9 @@ QMetaObject::Connection qobjectConnectCallback(QObject *source, const char *sign
         }
     }
 
-    auto connection = QMetaObject::connect(source, signalIndex, receiver.receiver, slotIndex, type);
+    auto connection = coalesce
+        ? CoalescingRelay::connect(source, signalIndex, receiver.receiver, slotIndex)
+        : QMetaObject::connect(source, signalIndex, receiver.receiver, slotIndex, type);
     if (!connection) {
         if (receiver.usingGlobalReceiver)
             signalManager.releaseGlobalReceiver(source, receiver.receiver);
@@ -226,6 +484,19 @@ QMetaObject::Connection qobjectConnectCallback(QObject *source, const char *sign
     return connection;
 }
 
+QMetaObject::Connection qobjectConnectCallback(QObject *source, const char *signal,
+                                               PyObject *callback, Qt::ConnectionType type)
+{
+    return connectCallback(source, signal, callback, type, false);
+}
+
+QMetaObject::Connection qobjectConnectCoalescedCallback(QObject *source, const char *signal,
+                                                        PyObject *callback,
+                                                        Qt::ConnectionType type)
+{
+    return connectCallback(source, signal, callback, type, true);
+}
+
 bool qobjectDisconnectCallback(QObject *source, const char *signal, PyObject *callback)
 {
     if (!PySide::Signal::checkQtSignal(signal))
@@ -239,8 +510,11 @@ bool qobjectDisconnectCallback(QObject *source, const char *signal, PyObject *ca
     const int signalIndex = source->metaObject()->indexOfSignal(signal + 1);
     const int slotIndex = receiver.slotIndex;
 
-    if (!QMetaObject::disconnectOne(source, signalIndex, receiver.receiver, slotIndex))
-        return false;
+    if (!QMetaObject::disconnectOne(source, signalIndex, receiver.receiver, slotIndex)) {
+        // Coalesced connections end at a relay.
+        if (!CoalescingRelay::release(source, signalIndex, receiver.receiver, slotIndex))
+            return false;
+    }
 
     Q_ASSERT(receiver.receiver);
     const QMetaMethod slotMethod = receiver.receiver->metaObject()->method(slotIndex);
@@ -253,4 +527,9 @@ bool qobjectDisconnectCallback(QObject *source, const char *signal, PyObject *ca
     return true;
 }
 
+void qobjectReleaseDisconnectedCoalescedCallbacks()
+{
+    CoalescingRelay::releaseDisconnected();
+}
+
 } // namespace PySide
@@ -33,10 +33,23 @@ PYSIDE_API QMetaObject::Connection
     qobjectConnectCallback(QObject *source, const char *signal,
                            PyObject *callback, Qt::ConnectionType type);
 
+/// Helpers for QObject::connect(): Make a coalescing connection to a Python
+/// callback. Emissions are always delivered queued in the receiver's thread;
+/// emissions occurring while a delivery is pending replace its arguments so
+/// that only the newest ones reach the callback per event loop iteration.
+/// Direct and blocking queued connection types raise a ValueError.
+PYSIDE_API QMetaObject::Connection
+    qobjectConnectCoalescedCallback(QObject *source, const char *signal,
+                                    PyObject *callback, Qt::ConnectionType type);
+
 /// Helpers for QObject::disconnect(): Disconnect a Python callback
 PYSIDE_API bool qobjectDisconnectCallback(QObject *source, const char *signal,
                                           PyObject *callback);
 
+/// Helpers for QObject::disconnect(): Release the relays of coalescing
+/// connections that were disconnected via QMetaObject::Connection
+PYSIDE_API void qobjectReleaseDisconnectedCoalescedCallbacks();
+
 } // namespace PySide
 
 #endif // QOBJECTCONNECT_H
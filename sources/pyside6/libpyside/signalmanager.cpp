@@ -25,6 +25,7 @@
 #include <QtCore/QByteArrayView>
 #include <QtCore/QDebug>
 #include <QtCore/QHash>
+#include <QtCore/QMutex>
 #include <QtCore/QScopedPointer>
 
 #include <algorithm>
@@ -211,8 +212,14 @@ struct SignalManager::SignalManagerPrivate
     void deleteGobalReceiver(const QObject *gr);
     void clear();
     void purgeEmptyGobalReceivers();
+    GlobalReceiverV2Ptr takeGlobalReceiver(const QObject *gr);
+    GlobalReceiverV2Ptr takeFirstGlobalReceiver(bool emptyOnly);
 
     GlobalReceiverV2Map m_globalReceivers;
+    // Protects m_globalReceivers and the links of the receivers. Receivers
+    // are created and destroyed without holding it since that runs Python
+    // code, which could otherwise deadlock on free-threaded Python builds.
+    QMutex m_globalReceiversMutex;
     static SignalManager::QmlMetaCallErrorHandler m_qmlMetaCallErrorHandler;
 
     static void handleMetaCallError(QObject *object, int *result);
@@ -294,10 +301,16 @@ QObject *SignalManager::globalReceiver(QObject *sender, PyObject *callback, QObj
 {
     auto &globalReceivers = m_d->m_globalReceivers;
     const GlobalReceiverKey key = GlobalReceiverV2::key(callback);
+    GlobalReceiverV2Ptr newReceiver; // Deleted after unlocking if it is not used
+    QMutexLocker locker(&m_d->m_globalReceiversMutex);
     auto it = globalReceivers.find(key);
     if (it == globalReceivers.end()) {
-        auto gr = std::make_shared<GlobalReceiverV2>(callback, receiver);
-        it = globalReceivers.insert(key, gr);
+        locker.unlock();
+        newReceiver = std::make_shared<GlobalReceiverV2>(callback, receiver);
+        locker.relock();
+        it = globalReceivers.find(key); // Another thread may have inserted one
+        if (it == globalReceivers.end())
+            it = globalReceivers.insert(key, newReceiver);
     }
     if (sender)
         it.value()->incRef(sender); // create a link reference
@@ -307,15 +320,21 @@ QObject *SignalManager::globalReceiver(QObject *sender, PyObject *callback, QObj
 
 void SignalManager::notifyGlobalReceiver(QObject *receiver)
 {
-    reinterpret_cast<GlobalReceiverV2 *>(receiver)->notify();
+    {
+        QMutexLocker locker(&m_d->m_globalReceiversMutex);
+        reinterpret_cast<GlobalReceiverV2 *>(receiver)->notify();
+    }
     m_d->purgeEmptyGobalReceivers();
 }
 
 void SignalManager::releaseGlobalReceiver(const QObject *source, QObject *receiver)
 {
     auto gr = static_cast<GlobalReceiverV2 *>(receiver);
+    QMutexLocker locker(&m_d->m_globalReceiversMutex);
     gr->decRef(source);
-    if (gr->isEmpty())
+    const bool empty = gr->isEmpty();
+    locker.unlock();
+    if (empty)
         m_d->deleteGobalReceiver(gr);
 }
 
@@ -324,14 +343,45 @@ void SignalManager::deleteGobalReceiver(const QObject *gr)
     SignalManager::instance().m_d->deleteGobalReceiver(gr);
 }
 
-void SignalManager::SignalManagerPrivate::deleteGobalReceiver(const QObject *gr)
+// Remove a receiver from the map under lock. It is deleted when the
+// returned pointer goes out of scope, outside of the lock.
+GlobalReceiverV2Ptr
+    SignalManager::SignalManagerPrivate::takeGlobalReceiver(const QObject *gr)
 {
+    QMutexLocker locker(&m_globalReceiversMutex);
     for (auto it = m_globalReceivers.begin(), end = m_globalReceivers.end(); it != end; ++it) {
         if (it.value().get() == gr) {
+            GlobalReceiverV2Ptr result = it.value();
             m_globalReceivers.erase(it);
-            break;
+            return result;
         }
     }
+    return {};
+}
+
+static bool isEmptyGlobalReceiver(const GlobalReceiverV2Ptr &g)
+{
+    return g->isEmpty();
+}
+
+GlobalReceiverV2Ptr
+    SignalManager::SignalManagerPrivate::takeFirstGlobalReceiver(bool emptyOnly)
+{
+    QMutexLocker locker(&m_globalReceiversMutex);
+    auto it = emptyOnly
+        ? std::find_if(m_globalReceivers.cbegin(), m_globalReceivers.cend(),
+                       isEmptyGlobalReceiver)
+        : m_globalReceivers.cbegin();
+    if (it == m_globalReceivers.cend())
+        return {};
+    GlobalReceiverV2Ptr result = it.value();
+    m_globalReceivers.erase(it);
+    return result;
+}
+
+void SignalManager::SignalManagerPrivate::deleteGobalReceiver(const QObject *gr)
+{
+    takeGlobalReceiver(gr);
 }
 
 void SignalManager::SignalManagerPrivate::clear()
@@ -340,24 +390,14 @@ void SignalManager::SignalManagerPrivate::clear()
     // because deleting a receiver can indirectly delete another one
     // via ~DynamicSlotDataV2(). Using ~QHash/clear() could cause an
     // iterator invalidation, and thus undefined behavior.
-    while (!m_globalReceivers.isEmpty())
-        m_globalReceivers.erase(m_globalReceivers.cbegin());
-}
-
-static bool isEmptyGlobalReceiver(const GlobalReceiverV2Ptr &g)
-{
-    return g->isEmpty();
+    while (takeFirstGlobalReceiver(false)) {
+    }
 }
 
 void SignalManager::SignalManagerPrivate::purgeEmptyGobalReceivers()
 {
     // Delete repetitively (see comment in clear()).
-    while (true) {
-        auto it = std::find_if(m_globalReceivers.cbegin(), m_globalReceivers.cend(),
-                               isEmptyGlobalReceiver);
-        if (it == m_globalReceivers.cend())
-            break;
-        m_globalReceivers.erase(it);
+    while (takeFirstGlobalReceiver(true)) {
     }
 }
 
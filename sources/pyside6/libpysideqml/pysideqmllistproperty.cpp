@@ -13,11 +13,38 @@
 #include <QtCore/QObject>
 #include <QtQml/QQmlListProperty>
 
+#include <unordered_map>
+#include <utility>
+
+// A wrapper kept alive by a native ListProperty for an object in the list
+struct QmlListPropertyReference
+{
+    PyObject *wrapper = nullptr;
+    qsizetype count = 0; // Number of occurrences of the object in the list
+};
+
+// Per-object storage of a ListProperty declared with "native=True". QML
+// reads the list without entering the interpreter; modifications from
+// Python and QML update the references to the wrappers of the objects.
+struct QmlListPropertyStorage
+{
+    QList<QObject *> objects;
+    std::unordered_map<const QObject *, QmlListPropertyReference> references;
+    QMetaObject::Connection destroyedConnection;
+};
+
 // This is the user data we store in the property.
 class QmlListPropertyPrivate : public PySidePropertyPrivate
 {
 public:
+    ~QmlListPropertyPrivate() override;
+
     void metaCall(PyObject *source, QMetaObject::Call call, void **args) override;
+    PyObject *getValue(PyObject *source) override;
+    int setValue(PyObject *source, PyObject *value) override;
+
+    QmlListPropertyStorage *storage(QObject *object);
+    void releaseStorage(const QObject *object);
 
     PyTypeObject *type = nullptr;
     PyObject *append = nullptr;
@@ -26,6 +53,10 @@ public:
     PyObject *clear = nullptr;
     PyObject *replace = nullptr;
     PyObject *removeLast = nullptr;
+    bool native = false;
+    PyObject *pyProperty = nullptr; // Borrowed back pointer to the ListProperty
+    // Node based to keep the lists referenced by QQmlListProperty stable.
+    std::unordered_map<const QObject *, QmlListPropertyStorage> storages;
 };
 
 extern "C"
@@ -34,7 +65,9 @@ extern "C"
 static PyObject *propList_tp_new(PyTypeObject *subtype, PyObject * /* args */, PyObject * /* kwds */)
 {
     PySideProperty *me = reinterpret_cast<PySideProperty *>(subtype->tp_alloc(subtype, 0));
-    me->d = new QmlListPropertyPrivate;
+    auto *data = new QmlListPropertyPrivate;
+    data->pyProperty = reinterpret_cast<PyObject *>(me);
+    me->d = data;
     return reinterpret_cast<PyObject *>(me);
 }
 
@@ -45,6 +78,7 @@ static int propListTpInit(PyObject *self, PyObject *args, PyObject *kwds)
                                    "doc", "notify", // PySideProperty
                                    "designable", "scriptable", "stored",
                                    "user", "constant", "final",
+                                   "native",
                                    nullptr};
     PySideProperty *pySelf = reinterpret_cast<PySideProperty *>(self);
 
@@ -53,7 +87,7 @@ static int propListTpInit(PyObject *self, PyObject *args, PyObject *kwds)
     char *doc{};
 
     if (!PyArg_ParseTupleAndKeywords(args, kwds,
-                                     "O|OOOOOOsObbbbbb:QtQml.ListProperty",
+                                     "O|OOOOOOsObbbbbbb:QtQml.ListProperty",
                                      const_cast<char **>(kwlist),
                                      &data->type,
                                      &data->append,
@@ -69,7 +103,8 @@ static int propListTpInit(PyObject *self, PyObject *args, PyObject *kwds)
                                              &(data->stored),
                                      /*bbb*/ &(data->user),
                                              &(data->constant),
-                                             &(data->final))) {
+                                             &(data->final),
+                                     /*b*/   &(data->native))) {
         return -1;
     }
 
@@ -96,6 +131,15 @@ static int propListTpInit(PyObject *self, PyObject *args, PyObject *kwds)
         return -1;
     }
 
+    auto isSet = [](PyObject *o) { return o != nullptr && o != Py_None; };
+    if (data->native && (isSet(data->append) || isSet(data->count) || isSet(data->at)
+                         || isSet(data->clear) || isSet(data->replace)
+                         || isSet(data->removeLast))) {
+        PyErr_SetString(PyExc_TypeError,
+                        "A native ListProperty cannot be combined with callbacks.");
+        return -1;
+    }
+
     data->typeName = QByteArrayLiteral("QQmlListProperty<QObject>");
 
     return 0;
@@ -122,8 +166,244 @@ PyTypeObject *PropertyList_TypeF(void)
     return type;
 }
 
+// Python sequence giving access to the native storage of a ListProperty
+// declared with "native=True" for a given QObject.
+struct PySideListPropertyStorage
+{
+    PyObject_HEAD
+    PyObject *property;
+    PyObject *owner;
+};
+
+static void propListStorageFree(void *vself)
+{
+    auto *self = reinterpret_cast<PySideListPropertyStorage *>(vself);
+    Py_XDECREF(self->property);
+    Py_XDECREF(self->owner);
+    Py_TYPE(self)->tp_base->tp_free(self);
+}
+
+static QmlListPropertyPrivate *propListStorageData(PyObject *self)
+{
+    auto *property = reinterpret_cast<PySideListPropertyStorage *>(self)->property;
+    return static_cast<QmlListPropertyPrivate *>(reinterpret_cast<PySideProperty *>(property)->d);
+}
+
+static QmlListPropertyStorage *propListStorage(PyObject *self)
+{
+    auto *owner = reinterpret_cast<PySideListPropertyStorage *>(self)->owner;
+    QObject *qobj = nullptr;
+    if (Shiboken::Object::isValid(owner))
+        Shiboken::Conversions::pythonToCppPointer(qObjectType(), owner, &qobj);
+    if (qobj == nullptr) {
+        if (!PyErr_Occurred())
+            PyErr_SetString(PyExc_RuntimeError, "The owner of the ListProperty was deleted.");
+        return nullptr;
+    }
+    return propListStorageData(self)->storage(qobj);
+}
+
+// Convert an item to be stored, checking the type
+static QObject *propListStorageItem(PyObject *self, PyObject *item)
+{
+    auto *data = propListStorageData(self);
+    if (!PyType_IsSubtype(Py_TYPE(item), data->type)) {
+        PyErr_Format(PyExc_TypeError, "A %s expected, got %s.",
+                     data->type->tp_name, Py_TYPE(item)->tp_name);
+        return nullptr;
+    }
+    QObject *result = nullptr;
+    Shiboken::Conversions::pythonToCppPointer(qObjectType(), item, &result);
+    return result;
+}
+
+// Count an occurrence of an object added to the list, keeping its wrapper
+// alive. Requires the GIL.
+static void propListStorageKeep(QmlListPropertyStorage *storage, QObject *item)
+{
+    auto &reference = storage->references[item];
+    if (reference.count++ == 0) {
+        reference.wrapper = reinterpret_cast<PyObject *>(
+            Shiboken::BindingManager::instance().retrieveWrapper(item));
+        Py_XINCREF(reference.wrapper);
+    }
+}
+
+// Release an occurrence of an object removed from the list. Requires the GIL.
+static void propListStorageRelease(QmlListPropertyStorage *storage, QObject *item)
+{
+    auto it = storage->references.find(item);
+    if (it == storage->references.end() || --it->second.count > 0)
+        return;
+    PyObject *wrapper = it->second.wrapper;
+    storage->references.erase(it);
+    Py_XDECREF(wrapper);
+}
+
+// Release all references when the list is cleared. Requires the GIL.
+static void propListStorageReleaseAll(QmlListPropertyStorage *storage)
+{
+    auto references = std::move(storage->references);
+    storage->references.clear();
+    for (const auto &it : references)
+        Py_XDECREF(it.second.wrapper);
+}
+
+static Py_ssize_t propListStorageLength(PyObject *self)
+{
+    auto *storage = propListStorage(self);
+    return storage != nullptr ? Py_ssize_t(storage->objects.size()) : -1;
+}
+
+static PyObject *propListStorageGetItem(PyObject *self, Py_ssize_t index)
+{
+    auto *storage = propListStorage(self);
+    if (storage == nullptr)
+        return nullptr;
+    if (index < 0 || index >= storage->objects.size()) {
+        PyErr_SetString(PyExc_IndexError, "ListProperty index out of range");
+        return nullptr;
+    }
+    return Shiboken::Conversions::pointerToPython(qObjectType(), storage->objects.at(index));
+}
+
+static int propListStorageSetItem(PyObject *self, Py_ssize_t index, PyObject *item)
+{
+    auto *storage = propListStorage(self);
+    if (storage == nullptr)
+        return -1;
+    if (index < 0 || index >= storage->objects.size()) {
+        PyErr_SetString(PyExc_IndexError, "ListProperty assignment index out of range");
+        return -1;
+    }
+    QObject *old = storage->objects.at(index);
+    if (item == nullptr) { // del list[index]
+        storage->objects.removeAt(index);
+    } else {
+        QObject *value = propListStorageItem(self, item);
+        if (value == nullptr)
+            return -1;
+        storage->objects[index] = value;
+        propListStorageKeep(storage, value);
+    }
+    propListStorageRelease(storage, old);
+    return 0;
+}
+
+static PyObject *propListStorageAppend(PyObject *self, PyObject *item)
+{
+    auto *storage = propListStorage(self);
+    if (storage == nullptr)
+        return nullptr;
+    QObject *value = propListStorageItem(self, item);
+    if (value == nullptr)
+        return nullptr;
+    storage->objects.append(value);
+    propListStorageKeep(storage, value);
+    Py_RETURN_NONE;
+}
+
+static PyObject *propListStorageClear(PyObject *self, PyObject * /* args */)
+{
+    auto *storage = propListStorage(self);
+    if (storage == nullptr)
+        return nullptr;
+    storage->objects.clear();
+    propListStorageReleaseAll(storage);
+    Py_RETURN_NONE;
+}
+
+static PyObject *propListStoragePop(PyObject *self, PyObject * /* args */)
+{
+    auto *storage = propListStorage(self);
+    if (storage == nullptr)
+        return nullptr;
+    if (storage->objects.isEmpty()) {
+        PyErr_SetString(PyExc_IndexError, "pop from empty ListProperty");
+        return nullptr;
+    }
+    QObject *last = storage->objects.takeLast();
+    PyObject *result = Shiboken::Conversions::pointerToPython(qObjectType(), last);
+    propListStorageRelease(storage, last);
+    return result;
+}
+
+static PyMethodDef PropertyListStorage_methods[] = {
+    {"append", reinterpret_cast<PyCFunction>(propListStorageAppend), METH_O, nullptr},
+    {"clear", reinterpret_cast<PyCFunction>(propListStorageClear), METH_NOARGS, nullptr},
+    {"pop", reinterpret_cast<PyCFunction>(propListStoragePop), METH_NOARGS, nullptr},
+    {nullptr, nullptr, 0, nullptr}  /* Sentinel */
+};
+
+static PyType_Slot PropertyListStorageType_slots[] = {
+    {Py_sq_length, reinterpret_cast<void *>(propListStorageLength)},
+    {Py_sq_item, reinterpret_cast<void *>(propListStorageGetItem)},
+    {Py_sq_ass_item, reinterpret_cast<void *>(propListStorageSetItem)},
+    {Py_tp_methods, reinterpret_cast<void *>(PropertyListStorage_methods)},
+    {Py_tp_free, reinterpret_cast<void *>(propListStorageFree)},
+    {Py_tp_dealloc, reinterpret_cast<void *>(Sbk_object_dealloc)},
+    {0, nullptr}
+};
+static PyType_Spec PropertyListStorageType_spec = {
+    "2:PySide6.QtQml.ListPropertyStorage",
+    sizeof(PySideListPropertyStorage),
+    0,
+    Py_TPFLAGS_DEFAULT,
+    PropertyListStorageType_slots,
+};
+
+static PyTypeObject *PropertyListStorage_TypeF(void)
+{
+    static auto *type = SbkType_FromSpec(&PropertyListStorageType_spec);
+    return type;
+}
+
 } // extern "C"
 
+QmlListPropertyPrivate::~QmlListPropertyPrivate()
+{
+    for (auto &it : storages) {
+        QObject::disconnect(it.second.destroyedConnection);
+        propListStorageReleaseAll(&it.second);
+    }
+}
+
+QmlListPropertyStorage *QmlListPropertyPrivate::storage(QObject *object)
+{
+    auto it = storages.find(object);
+    if (it == storages.end()) {
+        it = storages.emplace(object, QmlListPropertyStorage{}).first;
+        it->second.destroyedConnection =
+            QObject::connect(object, &QObject::destroyed,
+                             [this, object]() { releaseStorage(object); });
+    }
+    return &it->second;
+}
+
+void QmlListPropertyPrivate::releaseStorage(const QObject *object)
+{
+    auto it = storages.find(object);
+    if (it == storages.end())
+        return;
+    auto references = std::move(it->second.references);
+    storages.erase(it);
+    Shiboken::GilState state;
+    for (const auto &reference : references)
+        Py_XDECREF(reference.second.wrapper);
+}
+
+PyObject *QmlListPropertyPrivate::getValue(PyObject *source)
+{
+    if (!native)
+        return PySidePropertyPrivate::getValue(source);
+    auto *result = PyObject_New(PySideListPropertyStorage, PropertyListStorage_TypeF());
+    result->property = pyProperty;
+    Py_INCREF(pyProperty);
+    result->owner = source;
+    Py_INCREF(source);
+    return reinterpret_cast<PyObject *>(result);
+}
+
 // Implementation of QQmlListProperty<T>::AppendFunction callback
 void propListAppender(QQmlListProperty<QObject> *propList, QObject *item)
 {
@@ -248,6 +528,84 @@ void propListRemoveLast(QQmlListProperty<QObject> *propList)
         PyErr_Print();
 }
 
+// QQmlListProperty callbacks operating on the native storage. Reading does
+// not enter the interpreter, modifications update the references.
+static void propListStorageQmlAppend(QQmlListProperty<QObject> *propList, QObject *item)
+{
+    auto *storage = reinterpret_cast<QmlListPropertyStorage *>(propList->data);
+    Shiboken::GilState state;
+    storage->objects.append(item);
+    propListStorageKeep(storage, item);
+}
+
+static qsizetype propListStorageQmlCount(QQmlListProperty<QObject> *propList)
+{
+    return reinterpret_cast<QmlListPropertyStorage *>(propList->data)->objects.size();
+}
+
+static QObject *propListStorageQmlAt(QQmlListProperty<QObject> *propList, qsizetype index)
+{
+    return reinterpret_cast<QmlListPropertyStorage *>(propList->data)->objects.at(index);
+}
+
+static void propListStorageQmlClear(QQmlListProperty<QObject> *propList)
+{
+    auto *storage = reinterpret_cast<QmlListPropertyStorage *>(propList->data);
+    Shiboken::GilState state;
+    storage->objects.clear();
+    propListStorageReleaseAll(storage);
+}
+
+static void propListStorageQmlReplace(QQmlListProperty<QObject> *propList, qsizetype index,
+                                      QObject *value)
+{
+    auto *storage = reinterpret_cast<QmlListPropertyStorage *>(propList->data);
+    Shiboken::GilState state;
+    propListStorageKeep(storage, value);
+    QObject *old = std::exchange(storage->objects[index], value);
+    propListStorageRelease(storage, old);
+}
+
+static void propListStorageQmlRemoveLast(QQmlListProperty<QObject> *propList)
+{
+    auto *storage = reinterpret_cast<QmlListPropertyStorage *>(propList->data);
+    Shiboken::GilState state;
+    propListStorageRelease(storage, storage->objects.takeLast());
+}
+
+// Assigning a sequence replaces the contents of the native storage
+int QmlListPropertyPrivate::setValue(PyObject *source, PyObject *value)
+{
+    if (!native)
+        return PySidePropertyPrivate::setValue(source, value);
+    if (value == nullptr) {
+        PyErr_SetString(PyExc_AttributeError, "A ListProperty cannot be deleted");
+        return -1;
+    }
+    Shiboken::AutoDecRef items(PySequence_Fast(value, "A sequence expected."));
+    if (items.isNull())
+        return -1;
+    Shiboken::AutoDecRef storageObject(getValue(source));
+    const Py_ssize_t size = PySequence_Fast_GET_SIZE(items.object());
+    QList<QObject *> objects;
+    objects.reserve(size);
+    for (Py_ssize_t i = 0; i < size; ++i) {
+        QObject *object = propListStorageItem(storageObject, PySequence_Fast_GET_ITEM(items.object(), i));
+        if (object == nullptr)
+            return -1;
+        objects.append(object);
+    }
+    auto *storage = propListStorage(storageObject);
+    if (storage == nullptr)
+        return -1;
+    for (auto *object : std::as_const(objects))
+        propListStorageKeep(storage, object);
+    std::swap(storage->objects, objects);
+    for (auto *object : std::as_const(objects))
+        propListStorageRelease(storage, object);
+    return 0;
+}
+
 // qt_metacall specialization for ListProperties
 void QmlListPropertyPrivate::metaCall(PyObject *source, QMetaObject::Call call, void **args)
 {
@@ -257,6 +615,15 @@ void QmlListPropertyPrivate::metaCall(PyObject *source, QMetaObject::Call call,
     QObject *qobj;
     PyTypeObject *qobjectType = qObjectType();
     Shiboken::Conversions::pythonToCppPointer(qobjectType, source, &qobj);
+    if (native) { // Let QML operate on the native storage
+        *reinterpret_cast<QQmlListProperty<QObject> *>(args[0]) =
+            QQmlListProperty<QObject>(qobj, storage(qobj),
+                                      &propListStorageQmlAppend, &propListStorageQmlCount,
+                                      &propListStorageQmlAt, &propListStorageQmlClear,
+                                      &propListStorageQmlReplace,
+                                      &propListStorageQmlRemoveLast);
+        return;
+    }
     QQmlListProperty<QObject> declProp(
         qobj, this,
         append && append != Py_None ? &propListAppender : nullptr,
@@ -273,7 +640,8 @@ void QmlListPropertyPrivate::metaCall(PyObject *source, QMetaObject::Call call,
 
 static const char *PropertyList_SignatureStrings[] = {
     "PySide6.QtQml.ListProperty(self,type:type,append:typing.Callable,"
-        "at:typing.Callable=None,clear:typing.Callable=None,count:typing.Callable=None)",
+        "at:typing.Callable=None,clear:typing.Callable=None,count:typing.Callable=None,"
+        "native:bool=False)",
     nullptr // Sentinel
 };
 
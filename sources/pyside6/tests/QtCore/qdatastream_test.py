@@ -296,6 +296,11 @@ class QDataStreamBuffer(unittest.TestCase):
         data = QDataStream(ba)
         self.assertEqual(data.readRawData(4), bytes('AB\x00C', "UTF-8"))
 
+        data = QDataStream(ba)
+        buffer = bytearray(8)
+        self.assertEqual(data.readRawDataInto(buffer), 4)
+        self.assertEqual(buffer[:4], bytes('AB\x00C', "UTF-8"))
+
     def testBytes(self):
         dataOne = QDataStream()
         self.assertEqual(dataOne.readBytes(4), None)
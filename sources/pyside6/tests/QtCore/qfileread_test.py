@@ -61,6 +61,17 @@ class readDataTest(unittest.TestCase):
         s1 = self.filename1.read(50)
         self.assertEqual(s1, s2)
 
+    def testReadInto(self):
+        self.filename1.seek(0)
+        buffer = bytearray(9)
+        self.assertEqual(self.filename1.readinto(buffer), 9)
+        self.assertEqual(buffer, b'Test text')
+        view = memoryview(buffer)[4:]
+        self.assertEqual(self.filename1.readinto(view), 5)
+        self.assertEqual(buffer, b'Test for ')
+        with self.assertRaises(BufferError):
+            self.filename1.readinto(b'read-only')
+
 
 if __name__ == '__main__':
     unittest.main()
@@ -193,6 +193,28 @@ class ParentCase(unittest.TestCase):
         actual = parent.findChildren(QTimer)
         self.assertEqual(actual, expected)
 
+    def testFindChildrenMixedTypes(self):
+        # Mix of plain QObjects, Qt classes and Python-derived classes,
+        # matched natively by meta object or by Python type
+        parent = QObject()
+        objects = [QObject(parent) for i in range(5)]
+        timers = [QTimer(parent) for i in range(5)]
+        derived = [TestObject1(parent) for i in range(5)]
+        nested = TestObject2(objects[0])
+        for i, child in enumerate(objects + timers + derived):
+            child.setObjectName(f'child{i}')
+        nested.setObjectName('nested')
+
+        self.assertEqual(parent.findChildren(QTimer), [nested] + timers + derived)
+        self.assertEqual(parent.findChildren(TestObject1), [nested] + derived)
+        self.assertEqual(parent.findChildren(TestObject2), [nested])
+        self.assertEqual(parent.findChildren(TestObject1, '', Qt.FindDirectChildrenOnly),
+                         derived)
+        self.assertEqual(parent.findChild(QTimer, 'child7'), timers[2])
+        self.assertIsNone(parent.findChild(QTimer, 'child2'))
+        self.assertEqual(parent.findChild(TestObject2, 'nested'), nested)
+        self.assertIsNone(parent.findChild(TestObject2, 'child12'))
+
 
 class TestParentOwnership(unittest.TestCase):
     '''Test case for Parent/Child object ownership'''
@@ -0,0 +1,135 @@
+# Copyright (C) 2026 The Qt Company Ltd.
+# SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only WITH Qt-GPL-exception-1.0
+
+'''Stress tests using the global state of libpyside from many threads.
+
+They are mainly meant for free-threaded Python builds, where the threads
+execute in parallel, but also run with the GIL.'''
+
+import os
+import sys
+import threading
+import unittest
+
+from pathlib import Path
+sys.path.append(os.fspath(Path(__file__).resolve().parents[1]))
+from init_paths import init_test_paths
+init_test_paths(False)
+
+from PySide6.QtCore import QObject, Property, Qt, Signal, Slot
+from helper.usesqapplication import UsesQApplication
+
+
+THREAD_COUNT = max(8, os.cpu_count() or 1)
+ITERATIONS = 200
+
+
+def run_in_threads(function, *args):
+    '''Run function(index, *args) in THREAD_COUNT threads started at the same
+       time and re-raise the first exception.'''
+    barrier = threading.Barrier(THREAD_COUNT)
+    errors = []
+
+    def worker(index):
+        barrier.wait()
+        try:
+            function(index, *args)
+        except Exception as e:
+            errors.append(e)
+
+    threads = [threading.Thread(target=worker, args=(i,)) for i in range(THREAD_COUNT)]
+    for thread in threads:
+        thread.start()
+    for thread in threads:
+        thread.join()
+    if errors:
+        raise errors[0]
+
+
+class Sender(QObject):
+    valueChanged = Signal(int)
+
+    def __init__(self, parent=None):
+        super().__init__(parent)
+        self._value = 0
+
+    def getValue(self):
+        return self._value
+
+    def setValue(self, value):
+        self._value = value
+
+    value = Property(int, getValue, setValue)
+
+    def getRatio(self):
+        return self._value / 2
+
+    ratio = Property(float, getRatio)
+
+
+class Receiver(QObject):
+    def __init__(self, parent=None):
+        super().__init__(parent)
+        self.total = 0
+
+    @Slot(int)
+    def add(self, value):
+        self.total += value
+
+
+class QObjectThreadingStressTest(UsesQApplication):
+    '''Exercise the signal manager (global receivers, dynamic slots),
+       the property caches and the translation context cache from many
+       threads.'''
+
+    def testConnectEmitDisconnect(self):
+        def work(index):
+            sender = Sender()
+            receiver = Receiver()
+            values = []
+            for i in range(ITERATIONS):
+                # Callables use the global receivers of the signal manager
+                callback = values.append
+                sender.valueChanged.connect(callback, Qt.DirectConnection)
+                sender.valueChanged.connect(receiver.add, Qt.DirectConnection)
+                sender.valueChanged.emit(i)
+                self.assertTrue(sender.valueChanged.disconnect(callback))
+                self.assertTrue(sender.valueChanged.disconnect(receiver.add))
+                sender.valueChanged.emit(-1)  # Not delivered
+            self.assertEqual(values, list(range(ITERATIONS)))
+            self.assertEqual(receiver.total, ITERATIONS * (ITERATIONS - 1) // 2)
+
+        run_in_threads(work)
+
+    def testProperties(self):
+        shared = Sender()
+
+        def work(index):
+            own = Sender()
+            for i in range(ITERATIONS):
+                own.setProperty("value", i)
+                self.assertEqual(own.property("value"), i)
+                self.assertEqual(own.property("ratio"), i / 2)
+                shared.setProperty("value", index)
+                self.assertIn(shared.property("value"), range(THREAD_COUNT))
+
+        run_in_threads(work)
+
+    def testTranslate(self):
+        class Derived(QObject):
+            pass
+
+        # Install the language change watcher from the application thread.
+        self.assertEqual(Derived.tr("Hello"), "Hello")
+
+        def work(index):
+            types = [type(f"Dynamic{index}_{i}", (Derived,), {}) for i in range(10)]
+            for i in range(ITERATIONS):
+                self.assertEqual(types[i % 10].tr("Hello"), "Hello")
+                self.assertEqual(Derived.tr("World"), "World")
+
+        run_in_threads(work)
+
+
+if __name__ == '__main__':
+    unittest.main()
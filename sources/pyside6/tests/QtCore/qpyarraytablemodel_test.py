@@ -0,0 +1,88 @@
+# Copyright (C) 2023 The Qt Company Ltd.
+# SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only WITH Qt-GPL-exception-1.0
+
+'''Test cases for QPyArrayTableModel'''
+
+import array
+import math
+import os
+import sys
+import unittest
+
+from pathlib import Path
+sys.path.append(os.fspath(Path(__file__).resolve().parents[1]))
+from init_paths import init_test_paths
+init_test_paths(False)
+
+from PySide6.QtCore import QPersistentModelIndex, QPyArrayTableModel, Qt
+
+try:
+    import numpy as np
+    HAVE_NUMPY = True
+except ModuleNotFoundError:
+    HAVE_NUMPY = False
+
+
+class QPyArrayTableModelTest(unittest.TestCase):
+
+    def testArrays(self):
+        model = QPyArrayTableModel()
+        ids = array.array('i', [3, 1, 2])
+        values = array.array('d', [0.5, 2.5, 1.5])
+        model.addColumn(ids, "Id")
+        model.addColumn(values, "Value", lambda v: f"{v:.2f}")
+        self.assertEqual(model.rowCount(), 3)
+        self.assertEqual(model.columnCount(), 2)
+        self.assertEqual(model.headerData(1, Qt.Horizontal), "Value")
+        self.assertEqual(model.data(model.index(0, 0)), 3)
+        self.assertEqual(model.data(model.index(1, 1)), "2.50")
+        self.assertEqual(model.data(model.index(1, 1), Qt.EditRole), 2.5)
+        self.assertIs(model.columnArray(0), ids)
+
+        with self.assertRaises(ValueError):
+            model.addColumn(array.array('i', [1, 2]))
+        with self.assertRaises(IndexError):
+            model.columnArray(2)
+
+        ids[0] = 7
+        model.notifyDataChanged(0, 0)
+        self.assertEqual(model.data(model.index(0, 0)), 7)
+
+    def testSort(self):
+        model = QPyArrayTableModel()
+        model.addColumn(array.array('i', [3, 1, 2]), "Id")
+        model.addColumn(array.array('d', [0.5, float('nan'), 1.5]), "Value")
+        persistent = QPersistentModelIndex(model.index(0, 0))
+
+        model.sort(0)
+        self.assertEqual([model.data(model.index(r, 0)) for r in range(3)], [1, 2, 3])
+        self.assertTrue(math.isnan(model.data(model.index(0, 1), Qt.EditRole)))
+        self.assertEqual(persistent.row(), 2)
+
+        model.sort(1, Qt.DescendingOrder)
+        self.assertEqual([model.data(model.index(r, 0)) for r in range(3)], [1, 2, 3])
+        self.assertEqual(persistent.row(), 2)
+
+        model.sort(1)
+        self.assertEqual([model.data(model.index(r, 0)) for r in range(3)], [3, 2, 1])
+        self.assertEqual(persistent.row(), 0)
+
+    @unittest.skipUnless(HAVE_NUMPY, "requires numpy")
+    def testNumpy(self):
+        model = QPyArrayTableModel()
+        names = np.array(["pear", "apple", "fig"])
+        model.addColumn(names, "Name")
+        model.addColumn(np.arange(6, dtype=np.int64)[::2], "Even")
+        self.assertEqual(model.data(model.index(1, 0)), "apple")
+        self.assertEqual(model.data(model.index(2, 1)), 4)
+        model.sort(0)
+        self.assertEqual([model.data(model.index(r, 0)) for r in range(3)],
+                         ["apple", "fig", "pear"])
+        self.assertEqual(model.data(model.index(0, 1)), 2)
+
+        with self.assertRaises(ValueError):
+            model.addColumn(np.zeros((3, 2)))
+
+
+if __name__ == '__main__':
+    unittest.main()
@@ -4,9 +4,11 @@
 
 '''Unit tests to test QTranslator and translation in general.'''
 
+import gc
 import os
 import sys
 import unittest
+import weakref
 
 from pathlib import Path
 sys.path.append(os.fspath(Path(__file__).resolve().parents[1]))
@@ -90,6 +92,55 @@ class TranslationTest(UsesQApplication):
         obj.setObjectName(obj.tr('Hello World!'))
         self.assertEqual(obj.objectName(), 'привет мир!')
 
+    def testTranslatorChange(self):
+        # The resolved translation contexts are cached; check that installing
+        # and removing translators is taken into account.
+        class Derived(QObject):
+            pass
+
+        obj = Derived()
+        self.assertEqual(obj.tr('Hello World!'), 'Hello World!')
+
+        latin = QTranslator()
+        latin.load(os.path.join(self.trdir, 'trans_latin.qm'))
+        self.app.installTranslator(latin)
+        self.assertEqual(obj.tr('Hello World!'), 'Orbis, te saluto!')
+        self.assertEqual(obj.tr('Hello World!'), 'Orbis, te saluto!')
+
+        self.app.removeTranslator(latin)
+        self.assertEqual(obj.tr('Hello World!'), 'Hello World!')
+
+        russian = QTranslator()
+        russian.load(os.path.join(self.trdir, 'trans_russian.qm'))
+        self.app.installTranslator(russian)
+        self.assertEqual(Derived.tr('Hello World!'), 'привет мир!')
+        self.app.removeTranslator(russian)
+
+    def testTranslatorReload(self):
+        # Reloading an installed translator only posts QEvent.LanguageChange;
+        # tr() must not return the stale context meanwhile.
+        class Derived(QObject):
+            pass
+
+        translator = QTranslator()
+        translator.load(os.path.join(self.trdir, 'trans_latin.qm'))
+        self.app.installTranslator(translator)
+        self.assertEqual(Derived.tr('Hello World!'), 'Orbis, te saluto!')
+        translator.load(os.path.join(self.trdir, 'trans_russian.qm'))
+        self.assertEqual(Derived.tr('Hello World!'), 'привет мир!')
+        self.app.removeTranslator(translator)
+
+    def testDynamicClassReleased(self):
+        # The cache must not keep classes calling tr() alive.
+        class Dynamic(QObject):
+            pass
+
+        Dynamic.tr('Hello World!')
+        ref = weakref.ref(Dynamic)
+        del Dynamic
+        gc.collect()
+        self.assertIsNone(ref())
+
     def testTranslateWithNoneDisambiguation(self):
         value = 'String here'
         obj = QCoreApplication.translate('context', value, None)
@@ -3,6 +3,7 @@
 
 '''Test cases for QImage'''
 
+import ctypes
 import os
 import sys
 import unittest
@@ -12,10 +13,16 @@ sys.path.append(os.fspath(Path(__file__).resolve().parents[1]))
 from init_paths import init_test_paths
 init_test_paths(False)
 
-from PySide6.QtGui import QImage
+from PySide6.QtGui import QColor, QImage
 from helper.usesqapplication import UsesQApplication
 from xpm_data import xpm
 
+try:
+    import numpy as np
+    HAVE_NUMPY = True
+except ModuleNotFoundError:
+    HAVE_NUMPY = False
+
 
 class QImageTest(UsesQApplication):
     '''Test case for calling setPixel with float as argument'''
@@ -51,6 +58,100 @@ class QImageTest(UsesQApplication):
         self.assertEqual(img.width(), 27)
         self.assertEqual(img.height(), 22)
 
+    def testBufferProtocol(self):
+        img = QImage(5, 3, QImage.Format_RGB888)  # Scan lines padded to 16 bytes
+        img.fill(QColor(1, 2, 3))
+        view = memoryview(img)
+        self.assertEqual(view.shape, (3, 5, 3))
+        self.assertEqual(view.strides, (img.bytesPerLine(), 3, 1))
+        self.assertEqual(view.format, 'B')
+        self.assertEqual(view[2, 4, 2], 3)
+
+        img = QImage(4, 2, QImage.Format_Grayscale16)
+        view = memoryview(img)
+        self.assertEqual(view.shape, (2, 4))
+        self.assertEqual(view.itemsize, 2)
+
+        img = QImage(8, 8, QImage.Format_Mono)
+        self.assertRaises(BufferError, memoryview, img)
+
+        # Packed 24-bit pixels do not consist of byte channels
+        for packed_format in (QImage.Format_RGB666, QImage.Format_ARGB6666_Premultiplied,
+                              QImage.Format_ARGB8565_Premultiplied,
+                              QImage.Format_ARGB8555_Premultiplied):
+            img = QImage(4, 2, packed_format)
+            self.assertRaises(BufferError, memoryview, img)
+
+    def testBufferProtocolPlainBytes(self):
+        '''A buffer requested without PyBUF_ND consists of the bytes including
+           the padding, its format must match the item size of 1.'''
+        class Py_buffer(ctypes.Structure):
+            _fields_ = [("buf", ctypes.c_void_p), ("obj", ctypes.c_void_p),
+                        ("len", ctypes.c_ssize_t), ("itemsize", ctypes.c_ssize_t),
+                        ("readonly", ctypes.c_int), ("ndim", ctypes.c_int),
+                        ("format", ctypes.c_char_p), ("shape", ctypes.c_void_p),
+                        ("strides", ctypes.c_void_p), ("suboffsets", ctypes.c_void_p),
+                        ("internal", ctypes.c_void_p)]
+
+        PyBUF_FORMAT = 0x0004
+        get_buffer = ctypes.pythonapi.PyObject_GetBuffer
+        get_buffer.argtypes = [ctypes.py_object, ctypes.POINTER(Py_buffer), ctypes.c_int]
+        get_buffer.restype = ctypes.c_int
+        release_buffer = ctypes.pythonapi.PyBuffer_Release
+        release_buffer.argtypes = [ctypes.POINTER(Py_buffer)]
+        release_buffer.restype = None
+
+        for image_format in (QImage.Format_Grayscale16, QImage.Format_RGBA32FPx4):
+            img = QImage(3, 2, image_format)
+            view = Py_buffer()
+            self.assertEqual(get_buffer(img, ctypes.byref(view), PyBUF_FORMAT), 0)
+            try:
+                self.assertEqual(view.ndim, 1)
+                self.assertEqual(view.itemsize, 1)
+                self.assertEqual(view.len, img.sizeInBytes())
+                self.assertEqual(view.format, b"B")
+            finally:
+                release_buffer(ctypes.byref(view))
+
+    @unittest.skipUnless(HAVE_NUMPY, "requires numpy")
+    def testNumpyArray(self):
+        img = QImage(5, 3, QImage.Format_RGBA8888)
+        img.fill(QColor(10, 20, 30, 40))
+        array = np.asarray(img)
+        self.assertEqual(array.shape, (3, 5, 4))
+        self.assertEqual(array.dtype, np.uint8)
+        self.assertEqual(list(array[1, 2]), [10, 20, 30, 40])
+        array[0, 0] = (50, 60, 70, 80)
+        self.assertEqual(img.pixelColor(0, 0), QColor(50, 60, 70, 80))
+
+    @unittest.skipUnless(HAVE_NUMPY, "requires numpy")
+    def testArrayConstructor(self):
+        # Padded scan lines from a slice
+        data = np.zeros((4, 8, 4), dtype=np.uint8)
+        array = data[:, 1:6]
+        img = QImage(array, QImage.Format_RGBA8888)
+        self.assertEqual(img.size().toTuple(), (5, 4))
+        self.assertEqual(img.bytesPerLine(), 32)
+        array[1, 2] = (1, 2, 3, 255)  # Shared, not copied
+        self.assertEqual(img.pixelColor(2, 1), QColor(1, 2, 3))
+        del data, array
+        self.assertEqual(img.pixelColor(2, 1), QColor(1, 2, 3))
+
+        array = np.ones((2, 3, 4), dtype=np.float32)
+        img = QImage(array, QImage.Format_RGBA32FPx4)
+        self.assertEqual(img.size().toTuple(), (3, 2))
+
+        array = np.zeros((2, 3), dtype=np.uint8)
+        self.assertRaises(ValueError, QImage, array, QImage.Format_RGB888)
+        array = np.zeros((2, 3, 4), dtype=np.float32)
+        self.assertRaises(ValueError, QImage, array, QImage.Format_RGBA8888)
+
+        array = np.zeros((2, 3), dtype=np.uint8)
+        array.flags.writeable = False
+        img = QImage(array, QImage.Format_Grayscale8)
+        img.fill(255)  # Detaches
+        self.assertEqual(array.max(), 0)
+
 
 if __name__ == '__main__':
     unittest.main()
@@ -12,7 +12,7 @@ from init_paths import init_test_paths
 init_test_paths(False)
 
 from helper.usesqapplication import UsesQApplication
-from PySide6.QtGui import QPainter, QLinearGradient, QImage
+from PySide6.QtGui import QColor, QPainter, QLinearGradient, QImage
 from PySide6.QtCore import QLine, QLineF, QPoint, QPointF, QRect, QRectF, Qt
 
 
@@ -99,6 +99,46 @@ class QPainterDrawText(UsesQApplication):
             y = np.array([80.0, 10.0, 30.0, 70.0])
             self.painter.drawPointsNp(x, y)
 
+    @unittest.skipUnless(HAVE_NUMPY, "requires numpy")
+    def testDrawNumpyArrays(self):
+        image = QImage(8, 8, QImage.Format_ARGB32)
+        image.fill(Qt.white)
+        with QPainter(image) as painter:
+            lines = np.array([[0, 0, 7, 0], [0, 7, 7, 7]], dtype=np.int32)
+            painter.drawLinesNp(lines)
+            rects = np.array([[1.0, 1.0, 2.0, 2.0]])
+            painter.drawRectsNp(rects)
+            painter.drawEllipsesNp(rects.astype(np.float32))
+            # Strided view of the x, y columns of a larger array
+            points = np.array([[1.0, 0.0, 5.0], [2.0, 0.0, 5.0], [3.0, 0.0, 6.0]])[:, ::2]
+            painter.drawPolylineNp(points)
+            painter.drawPolygonNp(points, Qt.WindingFill)
+            sprites = np.array([[6, 2], [6, 3], [6, 4]], dtype=np.int64)
+            colors = np.array([0xffff0000, 0xffff0000, 0xff0000ff], dtype=np.uint32)
+            painter.drawColoredPointsNp(sprites, colors)
+            self.assertEqual(painter.pen().color(), QColor(Qt.black))
+        self.assertEqual(image.pixelColor(3, 0), QColor(Qt.black))
+        self.assertEqual(image.pixelColor(3, 7), QColor(Qt.black))
+        self.assertEqual(image.pixelColor(6, 2), QColor(Qt.red))
+        self.assertEqual(image.pixelColor(6, 3), QColor(Qt.red))
+        self.assertEqual(image.pixelColor(6, 4), QColor(Qt.blue))
+
+    @unittest.skipUnless(HAVE_NUMPY, "requires numpy")
+    def testDrawNumpyArraysErrors(self):
+        image = QImage(8, 8, QImage.Format_ARGB32)
+        with QPainter(image) as painter:
+            with self.assertRaises(ValueError):
+                painter.drawLinesNp(np.array([[0, 0, 7]], dtype=np.int32))
+            with self.assertRaises(ValueError):
+                painter.drawPolylineNp(np.array([1.0, 2.0]))
+            with self.assertRaises(TypeError):
+                painter.drawRectsNp(np.array([[1, 1, 2, 2]], dtype=np.int8))
+            points = np.array([[6, 2], [6, 3]], dtype=np.int32)
+            with self.assertRaises(TypeError):
+                painter.drawColoredPointsNp(points, np.array([1.0, 2.0]))
+            with self.assertRaises(ValueError):
+                painter.drawColoredPointsNp(points, np.array([0xffff0000], dtype=np.uint32))
+
 
 class SetBrushWithOtherArgs(UsesQApplication):
     '''Using qpainter.setBrush with args other than QBrush'''
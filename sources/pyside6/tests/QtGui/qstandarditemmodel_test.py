@@ -1,6 +1,7 @@
 # Copyright (C) 2022 The Qt Company Ltd.
 # SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only WITH Qt-GPL-exception-1.0
 
+import array
 import gc
 import os
 import sys
@@ -11,7 +12,7 @@ sys.path.append(os.fspath(Path(__file__).resolve().parents[1]))
 from init_paths import init_test_paths
 init_test_paths(False)
 
-from PySide6.QtCore import QObject
+from PySide6.QtCore import QObject, Qt
 from PySide6.QtGui import QStandardItemModel, QStandardItem
 from shiboken6 import Shiboken
 from helper.usesqapplication import UsesQApplication
@@ -42,6 +43,49 @@ class QStandardItemModelTest(UsesQApplication):
         model.clear()
         self.assertFalse(Shiboken.isValid(root))
 
+    def testAppendRows(self):
+        changes = []
+        self.model.dataChanged.connect(lambda tl, br, roles: changes.append((tl.row(), br.row())))
+        self.model.appendRows([["a", 1, 1.5], ["b", 2]])
+        self.model.appendRows([["c", 3, 2.5, True]])
+        self.assertEqual(self.model.rowCount(), 3)
+        self.assertEqual(self.model.columnCount(), 4)
+        self.assertEqual(self.model.item(1, 0).text(), "b")
+        self.assertIsNone(self.model.item(1, 2))
+        self.assertEqual(self.model.data(self.model.index(2, 1)), 3)
+        self.assertEqual(changes, [(0, 1), (2, 2)])
+
+    def testAppendRowsArray(self):
+        changed = []
+        self.model.itemChanged.connect(lambda item: changed.append(item.data(Qt.DisplayRole)))
+        # Two-dimensional buffer of 2 rows, 3 columns
+        values = memoryview(array.array('i', range(6))).cast('B').cast('i', [2, 3])
+        self.assertIsNone(self.model.appendRows(values))
+        self.assertEqual(self.model.rowCount(), 2)
+        self.assertEqual(self.model.data(self.model.index(1, 2)), 5)
+        self.assertEqual(changed, list(range(6)))
+
+    def testAppendRowsReturnItems(self):
+        rows = self.model.appendRows([["a", "b"], ["c"]], Qt.DisplayRole, True)
+        self.assertEqual([[item.text() for item in row] for row in rows], [["a", "b"], ["c"]])
+        self.assertTrue(rows[1][0] is self.model.item(1, 0))
+        # The items belong to the model
+        self.assertFalse(Shiboken.ownedByPython(rows[0][0]))
+
+    def testSetColumnData(self):
+        self.model.setColumnData(0, ["x", "y", "z"])
+        self.model.setColumnData(0, array.array('i', [1, 2, 3]), 0, Qt.UserRole)
+        self.model.setColumnData(1, array.array('d', [0.5]), 2)
+        self.assertEqual(self.model.rowCount(), 3)
+        item = self.model.item(2, 0)
+        self.assertEqual(item.text(), "z")
+        self.assertEqual(item.data(Qt.UserRole), 3)
+        self.assertEqual(self.model.item(2, 1).data(Qt.DisplayRole), 0.5)
+        self.assertIsNone(self.model.item(0, 1))
+        items = self.model.setColumnData(2, array.array('f', [1.0, 2.0]), 1, Qt.UserRole, True)
+        self.assertEqual([item.data(Qt.UserRole) for item in items], [1.0, 2.0])
+        self.assertTrue(items[0] is self.model.item(1, 2))
+
 
 class QStandardItemModelRef(UsesQApplication):
     @unittest.skipUnless(hasattr(sys, "getrefcount"), f"{sys.implementation.name} has no refcount")
@@ -4,6 +4,7 @@
 '''Test cases for QHttp'''
 
 import os
+import struct
 import sys
 import unittest
 
@@ -53,6 +54,25 @@ class testAudioDevices(UsesQApplication):
         actual_byte_array = QByteArray(bytearray(data))
         self.assertEqual(byte_array, actual_byte_array)
 
+    def test_audiobuffer_sample_array(self):
+        fmt = QAudioFormat()
+        fmt.setSampleFormat(QAudioFormat.Int16)
+        fmt.setChannelCount(2)
+        fmt.setSampleRate(8000)
+        samples = struct.pack('=6h', 1, -1, 2, -2, 3, -3)
+        buffer = QAudioBuffer(QByteArray(samples), fmt)
+        view = buffer.constSampleArray()
+        self.assertEqual(view.shape, (3, 2))
+        self.assertEqual(view.format, 'h')
+        self.assertTrue(view.readonly)
+        self.assertEqual(view.tolist(), [[1, -1], [2, -2], [3, -3]])
+
+        view = buffer.sampleArray()
+        self.assertFalse(view.readonly)
+        view[1, 1] = 42
+        del buffer  # The view keeps the buffer alive
+        self.assertEqual(view[1, 1], 42)
+
 
 if __name__ == '__main__':
     unittest.main()
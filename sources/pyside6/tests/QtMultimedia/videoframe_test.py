@@ -0,0 +1,49 @@
+# Copyright (C) 2023 The Qt Company Ltd.
+# SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only WITH Qt-GPL-exception-1.0
+
+'''Test cases for QVideoFrame'''
+
+import os
+import sys
+import unittest
+
+from pathlib import Path
+sys.path.append(os.fspath(Path(__file__).resolve().parents[1]))
+from init_paths import init_test_paths
+init_test_paths(False)
+
+from helper.usesqapplication import UsesQApplication
+from PySide6.QtCore import QSize
+from PySide6.QtMultimedia import QVideoFrame, QVideoFrameFormat
+
+
+class VideoFrameTest(UsesQApplication):
+
+    def testPlaneArrayNV12(self):
+        frame = QVideoFrame(QVideoFrameFormat(QSize(6, 4), QVideoFrameFormat.Format_NV12))
+        self.assertTrue(frame.map(QVideoFrame.ReadWrite))
+        luma = frame.planeArray(0)
+        self.assertEqual(luma.shape, (4, 6))
+        self.assertEqual(luma.strides[0], frame.bytesPerLine(0))
+        chroma = frame.planeArray(1)
+        self.assertEqual(chroma.shape, (2, 3, 2))
+        self.assertFalse(chroma.readonly)
+        chroma[1, 2, 1] = 7
+        self.assertEqual(frame.bits(1)[frame.bytesPerLine(1) + 5], 7)
+        self.assertRaises(IndexError, frame.planeArray, 2)
+        frame.unmap()
+
+    def testPlaneArrayReadOnly(self):
+        frame = QVideoFrame(QVideoFrameFormat(QSize(5, 3),
+                                              QVideoFrameFormat.Format_RGBA8888))
+        self.assertRaises(RuntimeError, frame.planeArray, 0)
+        self.assertTrue(frame.map(QVideoFrame.ReadOnly))
+        view = frame.planeArray(0)
+        self.assertEqual(view.shape, (3, 5, 4))
+        self.assertEqual(view.strides[1:], (4, 1))
+        self.assertTrue(view.readonly)
+        frame.unmap()
+
+
+if __name__ == '__main__':
+    unittest.main()
@@ -60,6 +60,22 @@ class HttpSignalsCase(unittest.TestCase):
 
         self.assertTrue(self.called)
 
+    def callbackInto(self):
+        buffer = bytearray(64)
+        while self.server.hasPendingDatagrams():
+            size, host, port = self.server.readDatagramInto(buffer)
+            self.received = bytes(buffer[:size])
+            self.called = True
+            self.app.quit()
+
+    def testReadDatagramInto(self):
+        self.server.readyRead.connect(self.callbackInto)
+        self.sendPackage()
+        self.app.exec()
+
+        self.assertTrue(self.called)
+        self.assertEqual(self.received, b'datagram')
+
 
 if __name__ == '__main__':
     unittest.main()
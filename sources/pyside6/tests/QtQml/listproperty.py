@@ -1,23 +1,29 @@
 # Copyright (C) 2022 The Qt Company Ltd.
 # SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only WITH Qt-GPL-exception-1.0
 
+import gc
 import os
 import sys
 import unittest
+import weakref
 
 from pathlib import Path
 sys.path.append(os.fspath(Path(__file__).resolve().parents[1]))
 from init_paths import init_test_paths
 init_test_paths(False)
 
-from PySide6.QtCore import QObject
-from PySide6.QtQml import ListProperty
+from PySide6.QtCore import QCoreApplication, QObject, QUrl
+from PySide6.QtQml import ListProperty, QQmlComponent, QQmlEngine
 
 
 class InheritsQObject(QObject):
     pass
 
 
+class NativeHolder(QObject):
+    items = ListProperty(InheritsQObject, native=True)
+
+
 def dummyFunc():
     pass
 
@@ -62,6 +68,76 @@ class TestListProperty(unittest.TestCase):
 
         self.assertTrue(method_check_error)
 
+    def testNative(self):
+        with self.assertRaises(TypeError):
+            ListProperty(QObject, append=dummyFunc, native=True)
+
+        holder = NativeHolder()
+        items = holder.items
+        self.assertEqual(len(items), 0)
+        first = InheritsQObject()
+        second = InheritsQObject()
+        items.append(first)
+        items.append(second)
+        with self.assertRaises(TypeError):
+            items.append(QObject())
+        self.assertEqual(len(holder.items), 2)
+        self.assertEqual(items[0], first)
+        self.assertEqual(items[1], second)
+        items[0] = second
+        self.assertEqual(items[0], second)
+        self.assertEqual(items.pop(), second)
+        self.assertEqual(len(items), 1)
+        holder.items = [first, second]
+        self.assertEqual(list(holder.items), [first, second])
+
+        # Check that QML sees the list
+        app = QCoreApplication.instance() or QCoreApplication(sys.argv)  # noqa: F841
+        engine = QQmlEngine()
+        engine.rootContext().setContextProperty("holder", holder)
+        component = QQmlComponent(engine)
+        component.setData(b"import QtQml\nQtObject { property int count: holder.items.length }",
+                          QUrl())
+        root = component.create()
+        self.assertTrue(root, component.errorString())
+        self.assertEqual(root.property("count"), 2)
+
+        items.clear()
+        self.assertEqual(len(items), 0)
+
+    @unittest.skipUnless(hasattr(sys, "getrefcount"), "requires sys.getrefcount()")
+    def testNativeReferences(self):
+        holder = NativeHolder()
+        items = holder.items
+        item = InheritsQObject()
+        refcount = sys.getrefcount(item)
+        # One reference per object regardless of the number of occurrences
+        items.append(item)
+        items.append(item)
+        self.assertEqual(sys.getrefcount(item), refcount + 1)
+        items[0] = items[0]
+        self.assertEqual(sys.getrefcount(item), refcount + 1)
+        items.pop()
+        self.assertEqual(sys.getrefcount(item), refcount + 1)
+        del items[0]
+        self.assertEqual(sys.getrefcount(item), refcount)
+        holder.items = [item, item]
+        holder.items = [item]
+        self.assertEqual(sys.getrefcount(item), refcount + 1)
+        items.clear()
+        self.assertEqual(sys.getrefcount(item), refcount)
+
+        # Objects are kept alive while in the list
+        item = InheritsQObject()
+        ref = weakref.ref(item)
+        items.append(item)
+        del item
+        gc.collect()
+        self.assertIsNotNone(ref())
+        items.clear()
+        gc.collect()
+        self.assertIsNone(ref())
+
 
 if __name__ == '__main__':
     unittest.main()
@@ -5,6 +5,7 @@
 '''Test cases for QtSql database creation, destruction and queries'''
 
 import gc
+import math
 import os
 import sys
 import unittest
@@ -70,6 +71,26 @@ class SqlDatabaseCreationDestructionAndQueries(unittest.TestCase):
         lastname = query.value(0)
         self.assertEqual(lastname, 'Harrison')
 
+    def testFetchColumns(self):
+        query = QSqlQuery()
+        query.exec("CREATE TABLE measurement(id int primary key, "
+                   "name varchar(20), value real)")
+        query.exec("INSERT INTO measurement VALUES(1, 'a', 0.5), (2, 'b', NULL), "
+                   "(3, NULL, 2.5)")
+        query.setForwardOnly(True)
+        self.assertTrue(query.exec("SELECT id, name, value FROM measurement ORDER BY id"))
+        ids, names, values = query.fetchColumns(2)
+        self.assertEqual(list(ids), [1, 2])
+        self.assertEqual(names, ['a', 'b'])
+        self.assertEqual(values[0], 0.5)
+        # NaN in numpy arrays, None in lists when numpy is not available
+        self.assertTrue(values[1] is None or math.isnan(values[1]))
+        ids, names, values = query.fetchColumns()
+        self.assertEqual(list(ids), [3])
+        self.assertEqual(names, [None])
+        ids, names, values = query.fetchColumns()
+        self.assertEqual(len(ids), 0)
+
     def testTableModelDeletion(self):
         app = QApplication([])
 
@@ -46,6 +46,23 @@ class loadUiTypeTester(UsesQApplication):
         self.assertTrue(isinstance(ui.child_object, QFrame))
         self.assertTrue(isinstance(ui.grandson_object, QPushButton))
 
+    def testCachedCode(self):
+        filePath = os.path.join(os.path.dirname(__file__), "minimal.ui")
+        first = loadUiType(filePath)
+        self.assertNotEqual(first, None)
+        # The second load uses the cached code and does not need pyside6-uic
+        oldPath = os.environ.get("PATH", "")
+        os.environ["PATH"] = ""
+        try:
+            second = loadUiType(filePath)
+        finally:
+            os.environ["PATH"] = oldPath
+        self.assertNotEqual(second, None)
+        generated, base = second
+        self.assertTrue("retranslateUi" in dir(generated))
+        self.assertTrue(isinstance(base(), QFrame))
+
+
 
 if __name__ == '__main__':
     unittest.main()
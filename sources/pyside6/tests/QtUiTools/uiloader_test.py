@@ -42,6 +42,20 @@ class QUiLoaderTester(UsesQApplication):
         self.assertNotEqual(child, None)
         self.assertEqual(w.findChild(QWidget, "grandson_object"), child.findChild(QWidget, "grandson_object"))
 
+    def testLazyChildAttributes(self):
+        loader = QUiLoader()
+        self.assertFalse(loader.lazyChildAttributes())
+        loader.setLazyChildAttributes(True)
+        self.assertTrue(loader.lazyChildAttributes())
+        w = loader.load(self._filePath)
+        self.assertNotEqual(w, None)
+        # Children are not set as attributes when loading
+        self.assertNotIn("grandson_object", w.__dict__)
+        self.assertEqual(w.grandson_object.objectName(), "grandson_object")
+        self.assertEqual(w.grandson_object, w.child_object.findChild(QWidget, "grandson_object"))
+        self.assertIn("grandson_object", w.__dict__)
+        self.assertFalse(hasattr(w, "nonexistent_object"))
+
     def testLoadFileOverride(self):
         # PYSIDE-1070, override QUiLoader::createWidget() with parent=None crashes
         loader = OverridingLoader()
@@ -0,0 +1,144 @@
+# Copyright (C) 2026 The Qt Company Ltd.
+# SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only WITH Qt-GPL-exception-1.0
+
+'''Test cases for coalesced connections delivering only the newest emission.'''
+
+import os
+import sys
+import unittest
+
+from pathlib import Path
+sys.path.append(os.fspath(Path(__file__).resolve().parents[1]))
+from init_paths import init_test_paths
+init_test_paths(False)
+
+from PySide6.QtCore import QCoreApplication, QObject, QThread, Qt, Signal, SIGNAL, Slot
+from shiboken6 import Shiboken
+from helper.usesqapplication import UsesQApplication
+
+
+EMISSION_COUNT = 1000
+
+
+class Emitter(QThread):
+    valueChanged = Signal(int)
+
+    def run(self):
+        for i in range(EMISSION_COUNT):
+            self.valueChanged.emit(i)
+
+
+class Sender(QObject):
+    valueChanged = Signal(int)
+
+
+class Receiver(QObject):
+    def __init__(self, parent=None):
+        super().__init__(parent)
+        self.values = []
+
+    @Slot(int)
+    def slot(self, value):
+        self.values.append(value)
+
+
+class CoalescedConnectionTest(UsesQApplication):
+
+    def _run(self, emitter):
+        emitter.start()
+        emitter.wait()  # The main event loop cannot deliver meanwhile.
+        QCoreApplication.processEvents()
+
+    def testCallable(self):
+        values = []
+        emitter = Emitter()
+        emitter.valueChanged.connect(lambda v: values.append(v), coalesce=True)
+        self._run(emitter)
+        self.assertEqual(values, [EMISSION_COUNT - 1])
+
+    def testSlot(self):
+        receiver = Receiver()
+        emitter = Emitter()
+        emitter.valueChanged.connect(receiver.slot, Qt.QueuedConnection, coalesce=True)
+        self._run(emitter)
+        self.assertEqual(receiver.values, [EMISSION_COUNT - 1])
+
+    def testUncoalesced(self):
+        receiver = Receiver()
+        emitter = Emitter()
+        emitter.valueChanged.connect(receiver.slot)
+        self._run(emitter)
+        self.assertEqual(receiver.values, list(range(EMISSION_COUNT)))
+
+    def testDisconnect(self):
+        receiver = Receiver()
+        emitter = Emitter()
+        emitter.valueChanged.connect(receiver.slot, coalesce=True)
+        self.assertTrue(emitter.valueChanged.disconnect(receiver.slot))
+        self._run(emitter)
+        self.assertEqual(receiver.values, [])
+
+    def testSignalReceiverRejected(self):
+        emitter = Emitter()
+        other = Emitter()
+        with self.assertRaises(TypeError):
+            emitter.valueChanged.connect(other.valueChanged, coalesce=True)
+
+    def testDirectConnectionRejected(self):
+        emitter = Emitter()
+        with self.assertRaises(ValueError):
+            emitter.valueChanged.connect(lambda v: None, Qt.DirectConnection,
+                                         coalesce=True)
+        with self.assertRaises(ValueError):
+            emitter.valueChanged.connect(lambda v: None, Qt.BlockingQueuedConnection,
+                                         coalesce=True)
+        with self.assertRaises(ValueError):
+            QObject.connect(emitter, SIGNAL("valueChanged(int)"), lambda v: None,
+                            Qt.DirectConnection, coalesce=True)
+
+    def testRelayNotAChild(self):
+        receiver = Receiver()
+        emitter = Emitter()
+        emitter.valueChanged.connect(receiver.slot, coalesce=True)
+        self.assertEqual(receiver.children(), [])
+        self.assertEqual(receiver.findChildren(QObject), [])
+
+    def testDisconnectConnection(self):
+        receiver = Receiver()
+        sender = Sender()
+        connection = sender.valueChanged.connect(receiver.slot, coalesce=True)
+        self.assertTrue(connection)
+        sender.valueChanged.emit(1)
+        self.assertTrue(QObject.disconnect(connection))
+        sender.valueChanged.emit(2)
+        QCoreApplication.processEvents()
+        self.assertEqual(receiver.values, [])
+
+    def testSourceDeleted(self):
+        receiver = Receiver()
+        sender = Sender()
+        sender.valueChanged.connect(receiver.slot, coalesce=True)
+        sender.valueChanged.emit(1)
+        Shiboken.delete(sender)
+        QCoreApplication.processEvents()
+        self.assertEqual(receiver.values, [])
+        # A new source allocated at the same address must not hit the old relay.
+        sender = Sender()
+        sender.valueChanged.connect(receiver.slot, coalesce=True)
+        sender.valueChanged.emit(3)
+        QCoreApplication.processEvents()
+        self.assertEqual(receiver.values, [3])
+
+    def testReceiverDeleted(self):
+        receiver = Receiver()
+        values = receiver.values
+        sender = Sender()
+        sender.valueChanged.connect(receiver.slot, coalesce=True)
+        sender.valueChanged.emit(1)
+        Shiboken.delete(receiver)
+        sender.valueChanged.emit(2)
+        QCoreApplication.processEvents()
+        self.assertEqual(values, [])
+
+if __name__ == '__main__':
+    unittest.main()
@@ -15,6 +15,7 @@
 #include "propertyspec.h"
 #include "reporthandler.h"
 #include "sourcelocation.h"
+#include "statistics.h"
 #include "typedatabase.h"
 #include "enumtypeentry.h"
 #include "enumvaluetypeentry.h"
@@ -32,6 +33,7 @@
 #include "usingmember.h"
 
 #include "parser/codemodel.h"
+#include "parser/codemodelcache.h"
 
 #include <clangparser/clangbuilder.h>
 #include <clangparser/clangutils.h>
@@ -108,6 +110,7 @@ AbstractMetaClassList AbstractMetaBuilder::takeClasses()
 {
     AbstractMetaClassList result;
     qSwap(result, d->m_metaClasses);
+    d->rebuildClassIndex();
     return result;
 }
 
@@ -174,7 +177,7 @@ void AbstractMetaBuilderPrivate::checkFunctionModifications()
             QString name = signature.trimmed();
             name.truncate(name.indexOf(u'('));
 
-            const auto clazz = AbstractMetaClass::findClass(m_metaClasses, centry);
+            const auto clazz = findClass(centry);
             if (!clazz)
                 continue;
 
@@ -213,7 +216,7 @@ AbstractMetaClassPtr AbstractMetaBuilderPrivate::argumentToClass(const ArgumentM
         return returned;
     TypeEntryCPtr entry = type->typeEntry();
     if (entry && entry->isComplex())
-        returned = AbstractMetaClass::findClass(m_metaClasses, entry);
+        returned = findClass(entry);
     return returned;
 }
 
@@ -286,7 +289,7 @@ void AbstractMetaBuilderPrivate::traverseOperatorFunction(const FunctionModelIte
             && (retType->isValue() || retType->isObject())
             && retType != baseoperandClass->typeEntry()
             && retType == otherArgClass->typeEntry()) {
-            baseoperandClass = AbstractMetaClass::findClass(m_metaClasses, retType);
+            baseoperandClass = findClass(retType);
             firstArgumentIsSelf = false;
         }
     }
@@ -411,8 +414,8 @@ void AbstractMetaBuilderPrivate::sortLists()
     // this is a temporary solution before new type revision implementation
     // We need move QMetaObject register before QObject.
     Dependencies additionalDependencies;
-    if (auto qObjectClass = AbstractMetaClass::findClass(m_metaClasses, u"QObject")) {
-        if (auto qMetaObjectClass = AbstractMetaClass::findClass(m_metaClasses, u"QMetaObject")) {
+    if (auto qObjectClass = findClass(u"QObject")) {
+        if (auto qMetaObjectClass = findClass(u"QMetaObject")) {
             Dependency dependency;
             dependency.parent = qMetaObjectClass;
             dependency.child = qObjectClass;
@@ -420,6 +423,7 @@ void AbstractMetaBuilderPrivate::sortLists()
         }
     }
     m_metaClasses = classesTopologicalSorted(m_metaClasses, additionalDependencies);
+    rebuildClassIndex();
 
     for (const auto &cls : std::as_const(m_metaClasses))
         cls->sortFunctions();
@@ -432,10 +436,25 @@ void AbstractMetaBuilderPrivate::sortLists()
     std::sort(m_globalFunctions.begin(), m_globalFunctions.end(), metaFunctionLessThan);
 }
 
+// Settings besides the arguments that influence the code model
+static QByteArrayList codeModelCacheSettings(bool addCompilerSupportArguments,
+                                             unsigned clangFlags)
+{
+    QByteArrayList result;
+    result << clang::libClangVersion().toString().toUtf8()
+        << QByteArray::number(clangFlags);
+    if (addCompilerSupportArguments)
+        result << clang::emulatedCompilerOptions() << clang::detectVulkan();
+    for (const auto &i : TypeDatabase::instance()->systemIncludes())
+        result << i.toUtf8();
+    return result;
+}
+
 FileModelItem AbstractMetaBuilderPrivate::buildDom(QByteArrayList arguments,
                                                    bool addCompilerSupportArguments,
                                                    LanguageLevel level,
-                                                   unsigned clangFlags)
+                                                   unsigned clangFlags,
+                                                   const QString &codeModelCacheDirectory)
 {
     clang::Builder builder;
     builder.setSystemIncludes(TypeDatabase::instance()->systemIncludes());
@@ -445,9 +464,35 @@ FileModelItem AbstractMetaBuilderPrivate::buildDom(QByteArrayList arguments,
         arguments.prepend(QByteArrayLiteral("-std=")
                           + clang::languageLevelOption(level));
     }
+
+    QByteArray cacheKey;
+    if (!codeModelCacheDirectory.isEmpty()) {
+        cacheKey = CodeModelCache::computeKey(arguments,
+                                              codeModelCacheSettings(addCompilerSupportArguments,
+                                                                     clangFlags));
+        QString errorMessage;
+        if (auto cached = CodeModelCache::load(codeModelCacheDirectory, cacheKey, &errorMessage)) {
+            if (ReportHandler::isDebug(ReportHandler::SparseDebug))
+                qCInfo(lcShiboken, "Using cached code model %s", cacheKey.constData());
+            return cached;
+        }
+        if (!errorMessage.isEmpty())
+            qCWarning(lcShiboken, "%s", qPrintable(errorMessage));
+    }
+
+    QStringList includedFiles;
     FileModelItem result = clang::parse(arguments, addCompilerSupportArguments,
-                                        clangFlags, builder)
+                                        clangFlags, builder,
+                                        cacheKey.isEmpty() ? nullptr : &includedFiles)
         ? builder.dom() : FileModelItem();
+    if (result && !cacheKey.isEmpty()) {
+        QString errorMessage;
+        if (!CodeModelCache::save(codeModelCacheDirectory, cacheKey, includedFiles,
+                                  result, &errorMessage)) {
+            qCWarning(lcShiboken, "Unable to write code model cache: %s",
+                      qPrintable(errorMessage));
+        }
+    }
     const clang::BaseVisitor::Diagnostics &diagnostics = builder.diagnostics();
     if (const auto diagnosticsCount = diagnostics.size()) {
         QDebug d = qWarning();
@@ -598,7 +643,7 @@ void AbstractMetaBuilderPrivate::traverseDom(const FileModelItem &dom,
                 && !entry->isContainer()
                 && !entry->isCustom()
                 && entry->generateCode()
-                && !AbstractMetaClass::findClass(m_metaClasses, entry)) {
+                && !findClass(entry)) {
                 qCWarning(lcShiboken, "%s", qPrintable(msgTypeNotDefined(entry)));
             } else if (entry->generateCode() && entry->type() == TypeEntry::FunctionType) {
                 auto fte = std::static_pointer_cast<const FunctionTypeEntry>(entry);
@@ -620,8 +665,7 @@ void AbstractMetaBuilderPrivate::traverseDom(const FileModelItem &dom,
                 }
             } else if (entry->isEnum() && entry->generateCode()) {
                 const auto enumEntry = std::static_pointer_cast<const EnumTypeEntry>(entry);
-                const auto cls = AbstractMetaClass::findClass(m_metaClasses,
-                                                              enumEntry->parent());
+                const auto cls = findClass(enumEntry->parent());
 
                 const bool enumFound = cls
                     ? cls->findEnum(entry->targetLangEntryName()).has_value()
@@ -709,13 +753,17 @@ bool AbstractMetaBuilder::build(const QByteArrayList &arguments,
                                 LanguageLevel level,
                                 unsigned clangFlags)
 {
+    Statistics::startPhase(u"Parsing C++ headers"_s);
     const FileModelItem dom = d->buildDom(arguments, addCompilerSupportArguments,
-                                          level, clangFlags);
+                                          level, clangFlags,
+                                          d->m_codeModelCacheDirectory);
     if (!dom)
         return false;
     if (ReportHandler::isDebug(ReportHandler::MediumDebug))
         qCDebug(lcShiboken) << dom.get();
+    Statistics::startPhase(u"Building meta model"_s);
     d->traverseDom(dom, apiExtractorFlags);
+    Statistics::endPhase();
 
     return true;
 }
@@ -738,9 +786,54 @@ void AbstractMetaBuilderPrivate::addAbstractMetaClass(const AbstractMetaClassPtr
         m_smartPointers << cls;
     } else {
         m_metaClasses << cls;
+        addToClassIndex(cls);
     }
 }
 
+void AbstractMetaBuilderPrivate::addToClassIndex(const AbstractMetaClassPtr &cls)
+{
+    // Keep the first class in case of clashes as the linear search does
+    if (!m_classByTypeEntry.contains(cls->typeEntry()))
+        m_classByTypeEntry.insert(cls->typeEntry(), cls);
+    const QString qualifiedName = cls->qualifiedCppName();
+    if (!m_classByQualifiedName.contains(qualifiedName))
+        m_classByQualifiedName.insert(qualifiedName, cls);
+    const QString name = cls->name();
+    if (!m_classByName.contains(name))
+        m_classByName.insert(name, cls);
+}
+
+void AbstractMetaBuilderPrivate::rebuildClassIndex()
+{
+    m_classByTypeEntry.clear();
+    m_classByQualifiedName.clear();
+    m_classByName.clear();
+    for (const auto &cls : std::as_const(m_metaClasses))
+        addToClassIndex(cls);
+}
+
+AbstractMetaClassPtr AbstractMetaBuilderPrivate::findClass(const TypeEntryCPtr &typeEntry) const
+{
+    Statistics::increment(Statistics::Counter::FindClass);
+    return m_classByTypeEntry.value(typeEntry);
+}
+
+// Mirrors the rules of findClassHelper() in abstractmetalang.cpp
+AbstractMetaClassPtr AbstractMetaBuilderPrivate::findClass(QStringView name) const
+{
+    if (name.isEmpty())
+        return {};
+    if (name.contains(u'.')) // Target lang name, rarely used
+        return AbstractMetaClass::findClass(m_metaClasses, name);
+    Statistics::increment(Statistics::Counter::FindClass);
+    const QString key = name.toString();
+    if (auto result = m_classByQualifiedName.value(key))
+        return result;
+    if (name.contains(u"::")) // Qualified, cannot possibly match name
+        return {};
+    return m_classByName.value(key);
+}
+
 AbstractMetaClassPtr
     AbstractMetaBuilderPrivate::traverseNamespace(const FileModelItem &dom,
                                                   const NamespaceModelItem &namespaceItem)
@@ -771,13 +864,13 @@ AbstractMetaClassPtr
     }
 
     // Continue populating namespace?
-    AbstractMetaClassPtr metaClass = AbstractMetaClass::findClass(m_metaClasses, type);
+    AbstractMetaClassPtr metaClass = findClass(type);
     if (!metaClass) {
         metaClass.reset(new AbstractMetaClass);
         metaClass->setTypeEntry(type);
         addAbstractMetaClass(metaClass, namespaceItem.get());
         if (auto extendsType = type->extends()) {
-            const auto extended = AbstractMetaClass::findClass(m_metaClasses, extendsType);
+            const auto extended = findClass(extendsType);
             if (!extended) {
                 qCWarning(lcShiboken, "%s",
                           qPrintable(msgNamespaceToBeExtendedNotFound(extendsType->name(), extendsType->targetLangPackage())));
@@ -1581,7 +1674,7 @@ bool AbstractMetaBuilderPrivate::setupInheritance(const AbstractMetaClassPtr &me
                           qPrintable(msgBaseNotInTypeSystem(metaClass, baseClassName)));
                 return false;
             }
-            auto baseClass = AbstractMetaClass::findClass(m_metaClasses, typeEntry);
+            auto baseClass = findClass(typeEntry);
             if (!baseClass) {
                 qCWarning(lcShiboken, "%s",
                           qPrintable(msgUnknownBase(metaClass, baseClassName)));
@@ -1596,7 +1689,7 @@ bool AbstractMetaBuilderPrivate::setupInheritance(const AbstractMetaClassPtr &me
     // Super class set by attribute "default-superclass".
     const QString defaultSuperclassName = metaClass->typeEntry()->defaultSuperclass();
     if (!defaultSuperclassName.isEmpty()) {
-        auto defaultSuper = AbstractMetaClass::findClass(m_metaClasses, defaultSuperclassName);
+        auto defaultSuper = findClass(defaultSuperclassName);
         if (defaultSuper != nullptr) {
             metaClass->setDefaultSuperclass(defaultSuper);
         } else {
@@ -3050,7 +3143,7 @@ AbstractMetaClassPtr
         }
 
         if (!templ)
-            templ = AbstractMetaClass::findClass(m_metaClasses, qualifiedName);
+            templ = findClass(qualifiedName);
 
         if (templ)
             return templ;
@@ -3073,7 +3166,7 @@ AbstractMetaClassCList
     for (const QString& parent : baseClassNames) {
         const auto cls = parent.contains(u'<')
             ? findTemplateClass(parent, metaClass)
-            : AbstractMetaClass::findClass(m_metaClasses, parent);
+            : findClass(parent);
 
         if (cls)
             baseClasses << cls;
@@ -3418,7 +3511,7 @@ void AbstractMetaBuilderPrivate::setupExternalConversion(const AbstractMetaClass
         if (func->isModifiedRemoved())
             continue;
         const auto metaClass =
-            AbstractMetaClass::findClass(m_metaClasses, func->type().typeEntry());
+            findClass(func->type().typeEntry());
         if (!metaClass)
             continue;
         metaClass->addExternalConversionOperator(func);
@@ -3475,14 +3568,17 @@ void AbstractMetaBuilderPrivate::dumpLog() const
 // AbstractMetaClassList/AbstractMetaClassCList.
 // Add a dependency of the class associated with typeEntry on clazz.
 template <class MetaClass>
-static bool addClassDependency(const QList<std::shared_ptr<MetaClass> > &classList,
+using TypeEntryClassHash = QHash<TypeEntryCPtr, std::shared_ptr<MetaClass> >;
+
+template <class MetaClass>
+static bool addClassDependency(const TypeEntryClassHash<MetaClass> &classHash,
                                const TypeEntryCPtr &typeEntry,
                                std::shared_ptr<MetaClass> clazz,
                                Graph<std::shared_ptr<MetaClass> > *graph)
 {
     if (!typeEntry->isComplex() || typeEntry == clazz->typeEntry())
         return false;
-    const auto c = AbstractMetaClass::findClass(classList, typeEntry);
+    const auto c = classHash.value(typeEntry);
     if (c == nullptr || c->enclosingClass() == clazz)
         return false;
     return graph->addEdge(c, clazz);
@@ -3495,6 +3591,13 @@ static QList<std::shared_ptr<MetaClass> >
 {
     Graph<std::shared_ptr<MetaClass> > graph(classList.cbegin(), classList.cend());
 
+    TypeEntryClassHash<MetaClass> classHash;
+    classHash.reserve(classList.size());
+    for (const auto &clazz : classList) {
+        if (!classHash.contains(clazz->typeEntry()))
+            classHash.insert(clazz->typeEntry(), clazz);
+    }
+
     for (const auto &dep : additionalDependencies) {
         if (!graph.addEdge(dep.parent, dep.child)) {
             qCWarning(lcShiboken).noquote().nospace()
@@ -3519,7 +3622,7 @@ static QList<std::shared_ptr<MetaClass> >
                 // ("QString s = QString()"), add a dependency.
                 if (!arg.originalDefaultValueExpression().isEmpty()
                     && arg.type().isValue()) {
-                    addClassDependency(classList, arg.type().typeEntry(),
+                    addClassDependency(classHash, arg.type().typeEntry(),
                                        clazz, &graph);
                 }
             }
@@ -3530,7 +3633,7 @@ static QList<std::shared_ptr<MetaClass> >
             if (typeEntry->isEnum()) // Enum defined in class?
                 typeEntry = typeEntry->parent();
             if (typeEntry != nullptr)
-                addClassDependency(classList, typeEntry, clazz, &graph);
+                addClassDependency(classHash, typeEntry, clazz, &graph);
         }
     }
 
@@ -3610,6 +3713,11 @@ void AbstractMetaBuilder::setUseGlobalHeader(bool h)
     AbstractMetaBuilderPrivate::m_useGlobalHeader = h;
 }
 
+void AbstractMetaBuilder::setCodeModelCacheDirectory(const QString &directory)
+{
+    d->m_codeModelCacheDirectory = directory;
+}
+
 void AbstractMetaBuilder::setSkipDeprecated(bool value)
 {
     d->m_skipDeprecated = value;
@@ -60,6 +60,9 @@ public:
                unsigned clangFlags = 0);
     void setLogDirectory(const QString& logDir);
 
+    /// Directory for caching the code model built by clang (see CodeModelCache)
+    void setCodeModelCacheDirectory(const QString &directory);
+
     /**
     *   AbstractMetaBuilder should know what's the global header being used,
     *   so any class declared under this header wont have the include file
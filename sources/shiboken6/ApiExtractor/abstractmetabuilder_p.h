@@ -52,7 +52,8 @@ public:
     static FileModelItem buildDom(QByteArrayList arguments,
                                   bool addCompilerSupportArguments,
                                   LanguageLevel level,
-                                  unsigned clangFlags);
+                                  unsigned clangFlags,
+                                  const QString &codeModelCacheDirectory = {});
     void traverseDom(const FileModelItem &dom, ApiExtractorFlags flags);
 
     void dumpLog() const;
@@ -74,6 +75,11 @@ public:
                                        const AbstractMetaClassCPtr &currentClass);
 
     void addAbstractMetaClass(const AbstractMetaClassPtr &cls, const _CodeModelItem *item);
+    // Indexed lookups of m_metaClasses, equivalent to AbstractMetaClass::findClass()
+    AbstractMetaClassPtr findClass(const TypeEntryCPtr &typeEntry) const;
+    AbstractMetaClassPtr findClass(QStringView name) const;
+    void addToClassIndex(const AbstractMetaClassPtr &cls);
+    void rebuildClassIndex();
     AbstractMetaClassPtr traverseTypeDef(const FileModelItem &dom,
                                        const TypeDefModelItem &typeDef,
                                        const AbstractMetaClassPtr &currentClass);
@@ -221,6 +227,10 @@ public:
     AbstractMetaClassList m_smartPointers;
     QHash<const _CodeModelItem *, AbstractMetaClassPtr > m_itemToClass;
     QHash<AbstractMetaClassCPtr, const _CodeModelItem *> m_classToItem;
+    // Index of m_metaClasses; the first class in list order wins
+    QHash<TypeEntryCPtr, AbstractMetaClassPtr> m_classByTypeEntry;
+    QHash<QString, AbstractMetaClassPtr> m_classByQualifiedName;
+    QHash<QString, AbstractMetaClassPtr> m_classByName;
     AbstractMetaFunctionCList m_globalFunctions;
     AbstractMetaEnumList m_globalEnums;
 
@@ -236,6 +246,7 @@ public:
     QList<NamespaceModelItem> m_scopes;
 
     QString m_logDirectory;
+    QString m_codeModelCacheDirectory;
     QFileInfoList m_globalHeaders;
     QStringList m_headerPaths;
     mutable QHash<QString, Include> m_resolveIncludeHash;
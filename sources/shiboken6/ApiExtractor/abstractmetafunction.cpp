@@ -26,8 +26,12 @@
 #include "qtcompat.h"
 
 #include <QtCore/QDebug>
+#include <QtCore/QMutex>
 #include <QtCore/QRegularExpression>
 
+#include <algorithm>
+#include <list>
+
 using namespace Qt::StringLiterals;
 
 // Cache FunctionModificationList in a flat list per class (0 for global
@@ -38,7 +42,14 @@ struct ModificationCacheEntry
      FunctionModificationList modifications;
 };
 
-using ModificationCache = QList<ModificationCacheEntry>;
+// A list keeps the references returned by modifications() valid while
+// entries are appended.
+using ModificationCache = std::list<ModificationCacheEntry>;
+
+// Protects the values computed on demand, which happens from several
+// threads when generating with --jobs. The values are computed without
+// holding the lock since that may recurse.
+static QBasicMutex cacheMutex;
 
 class AbstractMetaFunctionPrivate
 {
@@ -497,27 +508,34 @@ bool AbstractMetaFunction::isWhiteListed() const
 
 QString AbstractMetaFunctionPrivate::signature() const
 {
-    if (m_cachedSignature.isEmpty()) {
-        m_cachedSignature = m_originalName;
+    {
+        QMutexLocker locker(&cacheMutex);
+        if (!m_cachedSignature.isEmpty())
+            return m_cachedSignature;
+    }
 
-        m_cachedSignature += u'(';
+    QString result = m_originalName;
 
-        for (qsizetype i = 0; i < m_arguments.size(); ++i) {
-            const AbstractMetaArgument &a = m_arguments.at(i);
-            const AbstractMetaType &t = a.type();
-            if (i > 0)
-                m_cachedSignature += u", "_s;
-            m_cachedSignature += t.cppSignature();
-            // We need to have the argument names in the qdoc files
-            m_cachedSignature += u' ';
-            m_cachedSignature += a.name();
-        }
-        m_cachedSignature += u')';
+    result += u'(';
 
-        if (m_constant)
-            m_cachedSignature += u" const"_s;
+    for (qsizetype i = 0; i < m_arguments.size(); ++i) {
+        const AbstractMetaArgument &a = m_arguments.at(i);
+        const AbstractMetaType &t = a.type();
+        if (i > 0)
+            result += u", "_s;
+        result += t.cppSignature();
+        // We need to have the argument names in the qdoc files
+        result += u' ';
+        result += a.name();
     }
-    return m_cachedSignature;
+    result += u')';
+
+    if (m_constant)
+        result += u" const"_s;
+
+    QMutexLocker locker(&cacheMutex);
+    m_cachedSignature = result;
+    return result;
 }
 
 QString AbstractMetaFunction::signature() const
@@ -975,9 +993,15 @@ QString AbstractMetaFunctionPrivate::formatMinimalSignature(const AbstractMetaFu
 
 QString AbstractMetaFunction::minimalSignature() const
 {
-    if (d->m_cachedMinimalSignature.isEmpty())
-        d->m_cachedMinimalSignature = d->formatMinimalSignature(this, false);
-    return d->m_cachedMinimalSignature;
+    {
+        QMutexLocker locker(&cacheMutex);
+        if (!d->m_cachedMinimalSignature.isEmpty())
+            return d->m_cachedMinimalSignature;
+    }
+    const QString result = d->formatMinimalSignature(this, false);
+    QMutexLocker locker(&cacheMutex);
+    d->m_cachedMinimalSignature = result;
+    return result;
 }
 
 QStringList AbstractMetaFunction::modificationSignatures() const
@@ -1038,16 +1062,31 @@ const FunctionModificationList &
 {
     if (m_addedFunction)
         return m_addedFunction->modifications();
-    for (const auto &ce : m_modificationCache) {
-        if (ce.klass == implementor)
-            return ce.modifications;
+
+    auto findEntry = [this, &implementor]() {
+        return std::find_if(m_modificationCache.cbegin(), m_modificationCache.cend(),
+                            [&implementor](const ModificationCacheEntry &ce) {
+                                return ce.klass == implementor;
+                            });
+    };
+
+    {
+        QMutexLocker locker(&cacheMutex);
+        const auto it = findEntry();
+        if (it != m_modificationCache.cend())
+            return it->modifications;
     }
+
     auto modifications = m_class == nullptr
         ? AbstractMetaFunction::findGlobalModifications(q)
         : AbstractMetaFunction::findClassModifications(q, implementor);
 
-    m_modificationCache.append({implementor, modifications});
-    return m_modificationCache.constLast().modifications;
+    QMutexLocker locker(&cacheMutex);
+    const auto it = findEntry(); // Another thread might have added it meanwhile
+    if (it != m_modificationCache.cend())
+        return it->modifications;
+    m_modificationCache.push_back({implementor, modifications});
+    return m_modificationCache.back().modifications;
 }
 
 const FunctionModificationList &
@@ -1356,17 +1395,25 @@ bool AbstractMetaFunction::isVirtual() const
 
 QString AbstractMetaFunctionPrivate::modifiedName(const AbstractMetaFunction *q) const
 {
-    if (m_cachedModifiedName.isEmpty()) {
-        for (const auto &mod : q->modifications(q->implementingClass())) {
-            if (mod.isRenameModifier()) {
-                m_cachedModifiedName = mod.renamedToName();
-                break;
-            }
+    {
+        QMutexLocker locker(&cacheMutex);
+        if (!m_cachedModifiedName.isEmpty())
+            return m_cachedModifiedName;
+    }
+
+    QString result;
+    for (const auto &mod : q->modifications(q->implementingClass())) {
+        if (mod.isRenameModifier()) {
+            result = mod.renamedToName();
+            break;
         }
-        if (m_cachedModifiedName.isEmpty())
-            m_cachedModifiedName = m_name;
     }
-    return m_cachedModifiedName;
+    if (result.isEmpty())
+        result = m_name;
+
+    QMutexLocker locker(&cacheMutex);
+    m_cachedModifiedName = result;
+    return result;
 }
 
 QString AbstractMetaFunction::modifiedName() const
@@ -1435,16 +1482,23 @@ void AbstractMetaFunction::setExceptionHandlingModification(TypeSystem::Exceptio
 
 int AbstractMetaFunctionPrivate::overloadNumber(const AbstractMetaFunction *q) const
 {
-    if (m_cachedOverloadNumber == TypeSystem::OverloadNumberUnset) {
-        m_cachedOverloadNumber = TypeSystem::OverloadNumberDefault;
-        for (const auto &mod : q->modifications(q->implementingClass())) {
-            if (mod.overloadNumber() != TypeSystem::OverloadNumberUnset) {
-                m_cachedOverloadNumber = mod.overloadNumber();
-                break;
-            }
+    {
+        QMutexLocker locker(&cacheMutex);
+        if (m_cachedOverloadNumber != TypeSystem::OverloadNumberUnset)
+            return m_cachedOverloadNumber;
+    }
+
+    int result = TypeSystem::OverloadNumberDefault;
+    for (const auto &mod : q->modifications(q->implementingClass())) {
+        if (mod.overloadNumber() != TypeSystem::OverloadNumberUnset) {
+            result = mod.overloadNumber();
+            break;
         }
     }
-    return m_cachedOverloadNumber;
+
+    QMutexLocker locker(&cacheMutex);
+    m_cachedOverloadNumber = result;
+    return result;
 }
 
 int AbstractMetaFunction::overloadNumber() const
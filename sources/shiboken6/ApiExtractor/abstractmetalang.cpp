@@ -15,6 +15,7 @@
 #include "propertyspec.h"
 #include "reporthandler.h"
 #include "sourcelocation.h"
+#include "statistics.h"
 #include "typedatabase.h"
 #include "enumtypeentry.h"
 #include "namespacetypeentry.h"
@@ -23,8 +24,10 @@
 #include "qtcompat.h"
 
 #include <QtCore/QDebug>
+#include <QtCore/QMutex>
 
 #include <algorithm>
+#include <optional>
 
 using namespace Qt::StringLiterals;
 
@@ -51,8 +54,7 @@ public:
           m_hasVirtualDestructor(false),
           m_isTypeDef(false),
           m_hasToStringCapability(false),
-          m_valueTypeWithCopyConstructorOnly(false),
-          m_hasCachedWrapper(false)
+          m_valueTypeWithCopyConstructorOnly(false)
     {
     }
 
@@ -89,7 +91,6 @@ public:
     uint m_isTypeDef : 1;
     uint m_hasToStringCapability : 1;
     uint m_valueTypeWithCopyConstructorOnly : 1;
-    mutable uint m_hasCachedWrapper : 1;
 
     Documentation m_doc;
 
@@ -115,7 +116,8 @@ public:
     SourceLocation m_sourceLocation;
     UsingMembers m_usingMembers;
 
-    mutable AbstractMetaClass::CppWrapper m_cachedWrapper;
+    // Not a bit field since it is set on demand from the generator threads
+    mutable std::optional<AbstractMetaClass::CppWrapper> m_cachedWrapper;
     AbstractMetaClass::Attributes m_attributes;
 
     bool m_stream = false;
@@ -1109,11 +1111,16 @@ static AbstractMetaClass::CppWrapper determineCppWrapper(const AbstractMetaClass
 
 AbstractMetaClass::CppWrapper AbstractMetaClass::cppWrapper() const
 {
-    if (!d->m_hasCachedWrapper) {
-        d->m_cachedWrapper = determineCppWrapper(this);
-        d->m_hasCachedWrapper = true;
+    static QBasicMutex mutex;
+    {
+        QMutexLocker locker(&mutex);
+        if (d->m_cachedWrapper.has_value())
+            return d->m_cachedWrapper.value();
     }
-    return d->m_cachedWrapper;
+    const auto result = determineCppWrapper(this);
+    QMutexLocker locker(&mutex);
+    d->m_cachedWrapper = result;
+    return result;
 }
 
 const UsingMembers &AbstractMetaClass::usingMembers() const
@@ -1747,6 +1754,7 @@ static It findClassHelper(It begin, It end, QStringView name)
 AbstractMetaClassPtr AbstractMetaClass::findClass(const AbstractMetaClassList &classes,
                                                   QStringView name)
 {
+    Statistics::increment(Statistics::Counter::FindClass);
     auto it =findClassHelper(classes.cbegin(), classes.cend(), name);
     return it != classes.cend() ? *it : nullptr;
 }
@@ -1754,6 +1762,7 @@ AbstractMetaClassPtr AbstractMetaClass::findClass(const AbstractMetaClassList &c
 AbstractMetaClassCPtr AbstractMetaClass::findClass(const AbstractMetaClassCList &classes,
                                                    QStringView name)
 {
+    Statistics::increment(Statistics::Counter::FindClass);
     auto it = findClassHelper(classes.cbegin(), classes.cend(), name);
     return it != classes.cend() ? *it : nullptr;
 }
@@ -1761,6 +1770,7 @@ AbstractMetaClassCPtr AbstractMetaClass::findClass(const AbstractMetaClassCList
 AbstractMetaClassPtr AbstractMetaClass::findClass(const AbstractMetaClassList &classes,
                                                   const TypeEntryCPtr &typeEntry)
 {
+    Statistics::increment(Statistics::Counter::FindClass);
     for (AbstractMetaClassPtr c : classes) {
         if (c->typeEntry() == typeEntry)
             return c;
@@ -1771,6 +1781,7 @@ AbstractMetaClassPtr AbstractMetaClass::findClass(const AbstractMetaClassList &c
 AbstractMetaClassCPtr AbstractMetaClass::findClass(const AbstractMetaClassCList &classes,
                                                       const TypeEntryCPtr &typeEntry)
 {
+    Statistics::increment(Statistics::Counter::FindClass);
     for (auto c : classes) {
         if (c->typeEntry() == typeEntry)
             return c;
@@ -16,6 +16,7 @@
 #endif
 
 #include <QtCore/QHash>
+#include <QtCore/QMutex>
 #include <QtCore/QSharedData>
 #include <QtCore/QStack>
 
@@ -25,6 +26,11 @@ using namespace Qt::StringLiterals;
 
 using AbstractMetaTypeCPtr = std::shared_ptr<const AbstractMetaType>;
 
+// The cached signatures and the type cache of fromString() are accessed from
+// several threads when generating with --jobs.
+static QBasicMutex signatureCacheMutex;
+static QBasicMutex typeCacheMutex;
+
 const QSet<QString> &AbstractMetaType::cppFloatTypes()
 {
     static const QSet<QString> result{u"double"_s, u"float"_s};
@@ -51,55 +57,53 @@ const QSet<QString> &AbstractMetaType::cppCharTypes()
 
 const QSet<QString> &AbstractMetaType::cppSignedIntTypes()
 {
-    static QSet<QString> result;
-    if (result.isEmpty()) {
-        result = {u"char"_s, u"signed char"_s, u"short"_s, u"short int"_s,
-                  u"signed short"_s, u"signed short int"_s,
-                  u"int"_s, u"signed int"_s,
-                  u"long"_s, u"long int"_s,
-                  u"signed long"_s, u"signed long int"_s,
-                  u"long long"_s, u"long long int"_s,
-                  u"signed long long int"_s,
-                  u"ptrdiff_t"_s};
-        result |= cppSignedCharTypes();
-    }
+    static const QSet<QString> result = [] {
+        QSet<QString> types{u"char"_s, u"signed char"_s, u"short"_s, u"short int"_s,
+                            u"signed short"_s, u"signed short int"_s,
+                            u"int"_s, u"signed int"_s,
+                            u"long"_s, u"long int"_s,
+                            u"signed long"_s, u"signed long int"_s,
+                            u"long long"_s, u"long long int"_s,
+                            u"signed long long int"_s,
+                            u"ptrdiff_t"_s};
+        types |= cppSignedCharTypes();
+        return types;
+    }();
     return result;
 }
 
 const QSet<QString> &AbstractMetaType::cppUnsignedIntTypes()
 {
-    static QSet<QString> result;
-    if (result.isEmpty()) {
-        result = {u"unsigned short"_s, u"unsigned short int"_s,
-                  u"unsigned"_s, u"unsigned int"_s,
-                  u"unsigned long"_s, u"unsigned long int"_s,
-                  u"unsigned long long"_s,
-                  u"unsigned long long int"_s,
-                  u"size_t"_s};
-        result |= cppUnsignedCharTypes();
-    }
+    static const QSet<QString> result = [] {
+        QSet<QString> types{u"unsigned short"_s, u"unsigned short int"_s,
+                            u"unsigned"_s, u"unsigned int"_s,
+                            u"unsigned long"_s, u"unsigned long int"_s,
+                            u"unsigned long long"_s,
+                            u"unsigned long long int"_s,
+                            u"size_t"_s};
+        types |= cppUnsignedCharTypes();
+        return types;
+    }();
     return result;
 }
 
 const QSet<QString> &AbstractMetaType::cppIntegralTypes()
 {
-    static QSet<QString> result;
-    if (result.isEmpty()) {
-        result |= cppSignedIntTypes();
-        result |= cppUnsignedIntTypes();
-        result.insert(u"bool"_s);
-    }
+    static const QSet<QString> result = [] {
+        QSet<QString> types = cppSignedIntTypes() | cppUnsignedIntTypes();
+        types.insert(u"bool"_s);
+        return types;
+    }();
     return result;
 }
 
 const QSet<QString> &AbstractMetaType::cppPrimitiveTypes()
 {
-    static QSet<QString> result;
-    if (result.isEmpty()) {
-        result |= cppIntegralTypes();
-        result |= cppFloatTypes();
-        result.insert(u"wchar_t"_s);
-    }
+    static const QSet<QString> result = [] {
+        QSet<QString> types = cppIntegralTypes() | cppFloatTypes();
+        types.insert(u"wchar_t"_s);
+        return types;
+    }();
     return result;
 }
 
@@ -457,9 +461,15 @@ AbstractMetaType AbstractMetaType::plainType() const
 QString AbstractMetaType::cppSignature() const
 {
     const AbstractMetaTypeData *cd = d.constData();
-    if (cd->m_cachedCppSignature.isEmpty() || cd->m_signaturesDirty)
-        cd->m_cachedCppSignature = formatSignature(false);
-    return cd->m_cachedCppSignature;
+    {
+        QMutexLocker locker(&signatureCacheMutex);
+        if (!cd->m_cachedCppSignature.isEmpty() && !cd->m_signaturesDirty)
+            return cd->m_cachedCppSignature;
+    }
+    const QString result = formatSignature(false);
+    QMutexLocker locker(&signatureCacheMutex);
+    cd->m_cachedCppSignature = result;
+    return result;
 }
 
 QString AbstractMetaType::pythonSignature() const
@@ -467,9 +477,15 @@ QString AbstractMetaType::pythonSignature() const
     // PYSIDE-921: Handle container returntypes correctly.
     // This is now a clean reimplementation.
     const AbstractMetaTypeData *cd = d.constData();
-    if (cd->m_cachedPythonSignature.isEmpty() || cd->m_signaturesDirty)
-        cd->m_cachedPythonSignature = formatPythonSignature();
-    return cd->m_cachedPythonSignature;
+    {
+        QMutexLocker locker(&signatureCacheMutex);
+        if (!cd->m_cachedPythonSignature.isEmpty() && !cd->m_signaturesDirty)
+            return cd->m_cachedPythonSignature;
+    }
+    const QString result = formatPythonSignature();
+    QMutexLocker locker(&signatureCacheMutex);
+    cd->m_cachedPythonSignature = result;
+    return result;
 }
 
 AbstractMetaType::TypeUsagePattern AbstractMetaTypeData::determineUsagePattern() const
@@ -791,14 +807,14 @@ void AbstractMetaType::setViewOn(const AbstractMetaType &v)
 
 AbstractMetaType AbstractMetaType::createVoid()
 {
-    static QScopedPointer<AbstractMetaType> metaType;
-    if (metaType.isNull()) {
-        static TypeEntryCPtr voidTypeEntry = TypeDatabase::instance()->findType(u"void"_s);
+    static const AbstractMetaType metaType = [] {
+        const TypeEntryCPtr voidTypeEntry = TypeDatabase::instance()->findType(u"void"_s);
         Q_ASSERT(voidTypeEntry);
-        metaType.reset(new AbstractMetaType(voidTypeEntry));
-        metaType->decideUsagePattern();
-    }
-    return *metaType.data();
+        AbstractMetaType result(voidTypeEntry);
+        result.decideUsagePattern();
+        return result;
+    }();
+    return metaType;
 }
 
 void AbstractMetaType::dereference(QString *type)
@@ -944,6 +960,9 @@ AbstractMetaType::fromString(QString typeSignature, QString *errorMessage)
     if (typeSignature.startsWith(u"::"))
         typeSignature.remove(0, 2);
 
+    // The lock is held during translation, which may add type entries
+    // for non-type template parameters.
+    QMutexLocker locker(&typeCacheMutex);
     auto &cache = *metaTypeFromStringCache();
     auto it = cache.find(typeSignature);
     if (it == cache.end()) {
@@ -964,6 +983,7 @@ AbstractMetaType AbstractMetaType::fromTypeEntry(const TypeEntryCPtr &typeEntry)
     QString typeName = typeEntry->qualifiedCppName();
     if (typeName.startsWith(u"::"))
         typeName.remove(0, 2);
+    QMutexLocker locker(&typeCacheMutex);
     auto &cache  = *metaTypeFromStringCache();
     auto it = cache.find(typeName);
     if (it != cache.end())
@@ -14,6 +14,7 @@
 #include "messages.h"
 #include "modifications.h"
 #include "reporthandler.h"
+#include "statistics.h"
 #include "typedatabase.h"
 #include "customconversion.h"
 #include "containertypeentry.h"
@@ -69,6 +70,7 @@ struct ApiExtractorPrivate
     QStringList m_clangOptions;
     AbstractMetaBuilder *m_builder = nullptr;
     QString m_logDirectory;
+    QString m_codeModelCacheDirectory;
     LanguageLevel m_languageLevel = LanguageLevel::Default;
     bool m_skipDeprecated = false;
 };
@@ -124,6 +126,11 @@ void ApiExtractor::setLogDirectory(const QString& logDir)
     d->m_logDirectory = logDir;
 }
 
+void ApiExtractor::setCodeModelCacheDirectory(const QString &directory)
+{
+    d->m_codeModelCacheDirectory = directory;
+}
+
 void ApiExtractor::setCppFileNames(const QFileInfoList &cppFileName)
 {
     d->m_cppFileNames = cppFileName;
@@ -218,10 +225,12 @@ bool ApiExtractorPrivate::runHelper(ApiExtractorFlags flags)
     if (m_builder)
         return false;
 
+    Statistics::startPhase(u"Parsing typesystem"_s);
     if (!TypeDatabase::instance()->parseFile(m_typeSystemFileName)) {
         std::cerr << "Cannot parse file: " << qPrintable(m_typeSystemFileName);
         return false;
     }
+    Statistics::endPhase();
 
     const QString pattern = QDir::tempPath() + u'/'
         + m_cppFileNames.constFirst().baseName()
@@ -243,6 +252,7 @@ bool ApiExtractorPrivate::runHelper(ApiExtractorFlags flags)
     ppFile.close();
     m_builder = new AbstractMetaBuilder;
     m_builder->setLogDirectory(m_logDirectory);
+    m_builder->setCodeModelCacheDirectory(m_codeModelCacheDirectory);
     m_builder->setGlobalHeaders(m_cppFileNames);
     m_builder->setSkipDeprecated(m_skipDeprecated);
     m_builder->setHeaderPaths(m_includePaths);
@@ -296,11 +306,17 @@ std::optional<ApiExtractorResult> ApiExtractor::run(ApiExtractorFlags flags)
 {
     if (!d->runHelper(flags))
         return {};
+    StatisticsPhase phase(u"Collecting instantiations"_s);
     InstantiationCollectContext collectContext;
     d->collectInstantiatedContainersAndSmartPointers(collectContext);
 
     ApiExtractorResult result;
     classListToCList(d->m_builder->takeClasses(), &result.m_metaClasses);
+    result.m_classesByTypeEntry.reserve(result.m_metaClasses.size());
+    for (const auto &c : std::as_const(result.m_metaClasses)) {
+        if (!result.m_classesByTypeEntry.contains(c->typeEntry()))
+            result.m_classesByTypeEntry.insert(c->typeEntry(), c);
+    }
     classListToCList(d->m_builder->takeSmartPointers(), &result.m_smartPointers);
     result.m_globalFunctions = d->m_builder->globalFunctions();
     result.m_globalEnums = d->m_builder->globalEnums();
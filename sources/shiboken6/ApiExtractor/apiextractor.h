@@ -50,6 +50,7 @@ public:
     void addIncludePath(const HeaderPaths& paths);
     HeaderPaths includePaths() const;
     void setLogDirectory(const QString& logDir);
+    void setCodeModelCacheDirectory(const QString &directory);
     static bool setApiVersion(const QString &package, const QString &version);
     static void setDropTypeEntries(const QStringList &dropEntries);
     LanguageLevel languageLevel() const;
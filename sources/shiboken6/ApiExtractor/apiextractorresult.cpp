@@ -7,6 +7,7 @@
 
 #include "enumtypeentry.h"
 #include "flagstypeentry.h"
+#include "statistics.h"
 
 ApiExtractorResult::ApiExtractorResult() = default;
 
@@ -60,6 +61,13 @@ void ApiExtractorResult::setFlags(ApiExtractorFlags f)
     m_flags = f;
 }
 
+// Equivalent to AbstractMetaClass::findClass(classes(), typeEntry)
+AbstractMetaClassCPtr ApiExtractorResult::findClass(const TypeEntryCPtr &typeEntry) const
+{
+    Statistics::increment(Statistics::Counter::FindClass);
+    return m_classesByTypeEntry.value(typeEntry);
+}
+
 std::optional<AbstractMetaEnum>
     ApiExtractorResult::findAbstractMetaEnum(TypeEntryCPtr typeEntry) const
 {
@@ -74,7 +82,7 @@ std::optional<AbstractMetaEnum>
 AbstractMetaFunctionCList ApiExtractorResult::implicitConversions(const TypeEntryCPtr &type) const
 {
     if (type->isValue()) {
-        if (auto metaClass = AbstractMetaClass::findClass(m_metaClasses, type))
+        if (auto metaClass = findClass(type))
             return metaClass->implicitConversions();
     }
     return {};
@@ -44,6 +44,8 @@ public:
     const InstantiatedSmartPointers &instantiatedSmartPointers() const;
 
     // Query functions for the generators
+    AbstractMetaClassCPtr findClass(const TypeEntryCPtr &typeEntry) const;
+
     std::optional<AbstractMetaEnum>
         findAbstractMetaEnum(TypeEntryCPtr typeEntry) const;
 
@@ -66,6 +68,7 @@ private:
     AbstractMetaTypeList m_instantiatedContainers;
     InstantiatedSmartPointers m_instantiatedSmartPointers;
     QHash<TypeEntryCPtr, AbstractMetaEnum> m_enums;
+    QHash<TypeEntryCPtr, AbstractMetaClassCPtr> m_classesByTypeEntry;
     ApiExtractorFlags m_flags;
 
     friend class ApiExtractor;
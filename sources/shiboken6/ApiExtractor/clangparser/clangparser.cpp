@@ -277,8 +277,20 @@ static CXTranslationUnit createTranslationUnit(CXIndex index,
  * CXTranslationUnit_KeepGoing (from CINDEX_VERSION_MAJOR/CINDEX_VERSION_MINOR 0.35)
  */
 
+// Collect the included files, excluding the main file (include stack length 0)
+static void inclusionVisitor(CXFile includedFile, CXSourceLocation *,
+                             unsigned includeLength, CXClientData clientData)
+{
+    if (includeLength == 0)
+        return;
+    auto *includedFiles = reinterpret_cast<QStringList *>(clientData);
+    const QString fileName = getFileName(includedFile);
+    if (!fileName.isEmpty())
+        includedFiles->append(fileName);
+}
+
 bool parse(const QByteArrayList  &clangArgs, bool addCompilerSupportArguments,
-           unsigned clangFlags, BaseVisitor &bv)
+           unsigned clangFlags, BaseVisitor &bv, QStringList *includedFiles)
 {
     CXIndex index = clang_createIndex(0 /* excludeDeclarationsFromPCH */,
                                       1 /* displayDiagnostics */);
@@ -297,6 +309,11 @@ bool parse(const QByteArrayList  &clangArgs, bool addCompilerSupportArguments,
 
     clang_visitChildren(rootCursor, visitorCallback, reinterpret_cast<CXClientData>(&bv));
 
+    if (includedFiles != nullptr) {
+        clang_getInclusions(translationUnit, inclusionVisitor,
+                            reinterpret_cast<CXClientData>(includedFiles));
+    }
+
     QList<Diagnostic> diagnostics = getDiagnostics(translationUnit);
     diagnostics.append(bv.diagnostics());
     bv.setDiagnostics(diagnostics);
@@ -77,9 +77,11 @@ private:
     bool m_visitCurrent = true;
 };
 
+// includedFiles receives the files included by the translation unit if non-null.
 bool parse(const QByteArrayList  &clangArgs,
            bool addCompilerSupportArguments,
-           unsigned clangFlags, BaseVisitor &ctx);
+           unsigned clangFlags, BaseVisitor &ctx,
+           QStringList *includedFiles = nullptr);
 
 } // namespace clang
 
@@ -55,6 +55,7 @@ public:
     QStringView qualifiedName() const { return m_reader.qualifiedName(); }
 
     QStringView text() const { return m_reader.text(); }
+    bool isWhitespace() const { return m_reader.isWhitespace(); }
 
     QString errorString() const { return m_reader.errorString(); }
     QXmlStreamReader::Error error() const { return m_reader.error(); }
@@ -4,6 +4,7 @@
 #include "fileout.h"
 #include "messages.h"
 #include "reporthandler.h"
+#include "statistics.h"
 #include "exception.h"
 
 #include <QtCore/QFileInfo>
@@ -148,11 +149,18 @@ static void diff(const QByteArrayList &a, const QByteArrayList &b)
         unit.print(a, b);
 }
 
+qsizetype FileOut::size()
+{
+    stream.flush();
+    return m_buffer.size();
+}
+
 FileOut::State FileOut::done()
 {
     if (m_isDone)
         return Success;
 
+    StatisticsTimer timer(Statistics::Timer::FileOutput);
     bool fileEqual = false;
     QFile fileRead(m_name);
     QFileInfo info(fileRead);
@@ -185,6 +193,7 @@ FileOut::State FileOut::done()
             throw Exception(msgCannotOpenForWriting(fileWrite));
         if (fileWrite.write(m_buffer) == -1 || !fileWrite.flush())
             throw Exception(msgWriteFailed(fileWrite, m_buffer.size()));
+        Statistics::increment(Statistics::Counter::FilesWritten);
     }
     if (m_diff) {
         std::printf("%sFile: %s%s\n", colorInfo, qPrintable(m_name), colorReset);
@@ -22,6 +22,8 @@ public:
     ~FileOut();
 
     QString filePath() const { return m_name; }
+    /// Size of the contents written so far (flushes the stream)
+    qsizetype size();
 
     State done() noexcept(false);
 
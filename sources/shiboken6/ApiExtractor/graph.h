@@ -30,7 +30,7 @@ struct GraphSortResult
 };
 
 /// A graph that can have its nodes topologically sorted. The nodes need to
-/// have operator==().
+/// have operator==() and qHash().
 template <class Node>
 class Graph
 {
@@ -68,7 +68,11 @@ public:
     /// Removes an edge from this graph.
     bool removeEdge(Node from, Node to);
     /// Clears the graph
-    void clear() { m_nodeEntries.clear(); }
+    void clear()
+    {
+        m_nodeEntries.clear();
+        m_nodeIndexes.clear();
+    }
 
     /// Dumps a dot graph to a file named \p filename.
     /// \param fileName file name where the output should be written.
@@ -104,16 +108,13 @@ private:
     void depthFirstVisit(qsizetype i, NodeList &result) const;
 
     QList<NodeEntry> m_nodeEntries;
+    QHash<Node, qsizetype> m_nodeIndexes;
 };
 
 template <class Node>
 qsizetype Graph<Node>::indexOfNode(Node n) const
 {
-    for (qsizetype i = 0, size = m_nodeEntries.size(); i < size; ++i) {
-        if (m_nodeEntries.at(i).node == n)
-            return i;
-    }
-    return -1;
+    return m_nodeIndexes.value(n, -1);
 }
 
 template <class Node>
@@ -121,6 +122,7 @@ bool Graph<Node>::addNode(Node n)
 {
     if (hasNode(n))
         return false;
+    m_nodeIndexes.insert(n, m_nodeEntries.size());
     m_nodeEntries.append({n, {}, WHITE});
     return true;
 }
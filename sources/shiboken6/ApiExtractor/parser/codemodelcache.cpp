@@ -0,0 +1,682 @@
+// Copyright (C) 2023 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only WITH Qt-GPL-exception-1.0
+
+#include "codemodelcache.h"
+#include "codemodel.h"
+
+#include <QtCore/QCryptographicHash>
+#include <QtCore/QDataStream>
+#include <QtCore/QDir>
+#include <QtCore/QFile>
+#include <QtCore/QHash>
+#include <QtCore/QSaveFile>
+
+using namespace Qt::StringLiterals;
+
+static constexpr quint32 cacheMagic = 0x53434d43; // "SCMC"
+// Increment when the code model or the format changes.
+static constexpr quint32 cacheVersion = 1;
+
+static QString cacheFileName(const QString &directory, const QByteArray &key)
+{
+    return directory + u'/' + QString::fromLatin1(key) + u".codemodel"_s;
+}
+
+static QByteArray fileHash(const QString &fileName)
+{
+    QFile file(fileName);
+    if (!file.open(QIODevice::ReadOnly))
+        return {};
+    QCryptographicHash hash(QCryptographicHash::Sha1);
+    hash.addData(&file);
+    return hash.result();
+}
+
+QByteArray CodeModelCache::computeKey(const QByteArrayList &arguments,
+                                      const QByteArrayList &settings)
+{
+    QCryptographicHash hash(QCryptographicHash::Sha1);
+    hash.addData(QByteArray::number(cacheVersion));
+    for (qsizetype i = 0, last = arguments.size() - 1; i < last; ++i) {
+        hash.addData(arguments.at(i));
+        hash.addData("\n", 1);
+    }
+    if (!arguments.isEmpty()) {
+        QFile mainFile(QFile::decodeName(arguments.constLast()));
+        if (mainFile.open(QIODevice::ReadOnly))
+            hash.addData(mainFile.readAll());
+    }
+    for (const auto &setting : settings) {
+        hash.addData(setting);
+        hash.addData("\n", 1);
+    }
+    return hash.result().toHex();
+}
+
+// ---------------------------------------------------------------------------
+// Writing
+
+namespace {
+
+class ModelWriter
+{
+public:
+    explicit ModelWriter(QDataStream &s) : m_stream(s) {}
+
+    void write(const FileModelItem &dom);
+
+private:
+    void indexClasses(const _ScopeModelItem *scope);
+    void indexNamespaceClasses(const _NamespaceModelItem *ns);
+
+    void writeItem(_CodeModelItem *item);
+    void writeTypeInfo(const TypeInfo &t);
+    void writeScope(_ScopeModelItem *scope);
+    void writeNamespace(_NamespaceModelItem *ns);
+    void writeClass(_ClassModelItem *klass);
+    void writeTemplateParameters(const TemplateParameterList &parameters);
+    void writeMember(_MemberModelItem *member);
+    void writeFunction(_FunctionModelItem *function);
+    void writeEnum(_EnumModelItem *e);
+
+    QDataStream &m_stream;
+    QHash<const _ClassModelItem *, qint32> m_classIndexes;
+};
+
+void ModelWriter::write(const FileModelItem &dom)
+{
+    indexNamespaceClasses(dom.get());
+    m_stream << qint32(m_classIndexes.size());
+    writeNamespace(dom.get());
+}
+
+// Classes are numbered in the order in which they are written to be able to
+// restore the links to the base classes.
+void ModelWriter::indexClasses(const _ScopeModelItem *scope)
+{
+    for (const auto &c : scope->classes()) {
+        const auto index = qint32(m_classIndexes.size());
+        m_classIndexes.insert(c.get(), index);
+        indexClasses(c.get());
+    }
+}
+
+void ModelWriter::indexNamespaceClasses(const _NamespaceModelItem *ns)
+{
+    indexClasses(ns);
+    for (const auto &n : ns->namespaces())
+        indexNamespaceClasses(n.get());
+}
+
+void ModelWriter::writeItem(_CodeModelItem *item)
+{
+    int startLine{};
+    int startColumn{};
+    int endLine{};
+    int endColumn{};
+    item->getStartPosition(&startLine, &startColumn);
+    item->getEndPosition(&endLine, &endColumn);
+    m_stream << item->name() << item->scope() << item->fileName()
+        << qint32(startLine) << qint32(startColumn)
+        << qint32(endLine) << qint32(endColumn);
+}
+
+void ModelWriter::writeTypeInfo(const TypeInfo &t)
+{
+    m_stream << t.qualifiedName() << t.isConstant() << t.isVolatile()
+        << qint32(t.referenceType()) << t.isFunctionPointer() << t.arrayElements();
+    const auto &indirections = t.indirectionsV();
+    m_stream << qint32(indirections.size());
+    for (auto i : indirections)
+        m_stream << qint32(i);
+    const auto &arguments = t.arguments();
+    m_stream << qint32(arguments.size());
+    for (const auto &a : arguments)
+        writeTypeInfo(a);
+    const auto &instantiations = t.instantiations();
+    m_stream << qint32(instantiations.size());
+    for (const auto &i : instantiations)
+        writeTypeInfo(i);
+}
+
+void ModelWriter::writeTemplateParameters(const TemplateParameterList &parameters)
+{
+    m_stream << qint32(parameters.size());
+    for (const auto &p : parameters) {
+        writeItem(p.get());
+        writeTypeInfo(p->type());
+        m_stream << p->defaultValue();
+    }
+}
+
+void ModelWriter::writeScope(_ScopeModelItem *scope)
+{
+    writeItem(scope);
+    m_stream << scope->enumsDeclarations();
+
+    const auto classes = scope->classes();
+    m_stream << qint32(classes.size());
+    for (const auto &c : classes)
+        writeClass(c.get());
+
+    const auto &enums = scope->enums();
+    m_stream << qint32(enums.size());
+    for (const auto &e : enums)
+        writeEnum(e.get());
+
+    const auto &functions = scope->functions();
+    m_stream << qint32(functions.size());
+    for (const auto &f : functions)
+        writeFunction(f.get());
+
+    const auto typeDefs = scope->typeDefs();
+    m_stream << qint32(typeDefs.size());
+    for (const auto &t : typeDefs) {
+        writeItem(t.get());
+        writeTypeInfo(t->type());
+    }
+
+    const auto aliases = scope->templateTypeAliases();
+    m_stream << qint32(aliases.size());
+    for (const auto &a : aliases) {
+        writeItem(a.get());
+        writeTemplateParameters(a->templateParameters());
+        writeTypeInfo(a->type());
+    }
+
+    const auto variables = scope->variables();
+    m_stream << qint32(variables.size());
+    for (const auto &v : variables)
+        writeMember(v.get());
+}
+
+void ModelWriter::writeNamespace(_NamespaceModelItem *ns)
+{
+    writeScope(ns);
+    m_stream << qint32(ns->type());
+    const auto &namespaces = ns->namespaces();
+    m_stream << qint32(namespaces.size());
+    for (const auto &n : namespaces)
+        writeNamespace(n.get());
+}
+
+void ModelWriter::writeClass(_ClassModelItem *klass)
+{
+    writeScope(klass);
+    const auto &baseClasses = klass->baseClasses();
+    m_stream << qint32(baseClasses.size());
+    for (const auto &b : baseClasses) {
+        // Bases that are not part of the model (purged declarations) are dropped.
+        const qint32 index = b.klass ? m_classIndexes.value(b.klass.get(), -1) : -1;
+        m_stream << b.name << index << qint32(b.accessPolicy);
+    }
+    const auto &usingMembers = klass->usingMembers();
+    m_stream << qint32(usingMembers.size());
+    for (const auto &u : usingMembers)
+        m_stream << u.className << u.memberName << qint32(u.access);
+    writeTemplateParameters(klass->templateParameters());
+    m_stream << qint32(klass->classType()) << klass->propertyDeclarations()
+        << klass->isFinal();
+}
+
+void ModelWriter::writeMember(_MemberModelItem *member)
+{
+    writeItem(member);
+    m_stream << member->isConstant() << member->isVolatile() << member->isStatic()
+        << member->isAuto() << member->isFriend() << member->isRegister()
+        << member->isExtern() << member->isMutable()
+        << qint32(member->accessPolicy());
+    writeTemplateParameters(member->templateParameters());
+    writeTypeInfo(member->type());
+}
+
+void ModelWriter::writeFunction(_FunctionModelItem *function)
+{
+    writeMember(function);
+    const auto arguments = function->arguments();
+    m_stream << qint32(arguments.size());
+    for (const auto &a : arguments) {
+        writeItem(a.get());
+        writeTypeInfo(a->type());
+        m_stream << a->defaultValue() << a->defaultValueExpression()
+            << a->scopeResolution();
+    }
+    m_stream << qint32(function->functionType())
+        << function->isDeleted() << function->isVirtual() << function->isOverride()
+        << function->isFinal() << function->isDeprecated() << function->isInline()
+        << function->isAbstract() << function->isExplicit() << function->isVariadics()
+        << function->isHiddenFriend() << function->isInvokable()
+        << function->scopeResolution()
+        << qint32(function->exceptionSpecification());
+}
+
+void ModelWriter::writeEnum(_EnumModelItem *e)
+{
+    writeItem(e);
+    m_stream << qint32(e->accessPolicy()) << qint32(e->enumKind())
+        << e->isDeprecated() << e->isSigned();
+    const auto enumerators = e->enumerators();
+    m_stream << qint32(enumerators.size());
+    for (const auto &v : enumerators) {
+        writeItem(v.get());
+        auto value = v->value();
+        m_stream << v->stringValue() << qint32(value.type());
+        if (value.type() == EnumValue::Signed)
+            m_stream << value.value();
+        else
+            m_stream << value.unsignedValue();
+        m_stream << v->isDeprecated();
+    }
+}
+
+// ---------------------------------------------------------------------------
+// Reading
+
+class ModelReader
+{
+public:
+    explicit ModelReader(QDataStream &s, CodeModel *model) : m_stream(s), m_model(model) {}
+
+    FileModelItem read();
+
+private:
+    struct PendingBase
+    {
+        _ClassModelItem *klass;
+        QString name;
+        qint32 index;
+        Access access;
+    };
+
+    template <class Item>
+    std::shared_ptr<Item> readItem();
+    TypeInfo readTypeInfo();
+    qint32 readCount();
+    void readScope(_ScopeModelItem *scope);
+    void readNamespace(_NamespaceModelItem *ns);
+    ClassModelItem readClass();
+    TemplateParameterList readTemplateParameters();
+    void readMember(_MemberModelItem *member);
+    FunctionModelItem readFunction();
+    EnumModelItem readEnum();
+
+    bool ok() const { return m_stream.status() == QDataStream::Ok; }
+
+    QDataStream &m_stream;
+    CodeModel *m_model;
+    ClassList m_classes;
+    QList<PendingBase> m_pendingBases;
+};
+
+FileModelItem ModelReader::read()
+{
+    const qint32 classCount = readCount();
+    if (!ok())
+        return {};
+    m_classes.reserve(classCount);
+    auto result = readItem<_FileModelItem>();
+    readNamespace(result.get());
+    if (!ok() || m_classes.size() != classCount)
+        return {};
+    for (const auto &p : std::as_const(m_pendingBases)) {
+        ClassModelItem base = p.index >= 0 && p.index < m_classes.size()
+            ? m_classes.at(p.index) : ClassModelItem{};
+        p.klass->addBaseClass({p.name, base, p.access});
+    }
+    return result;
+}
+
+qint32 ModelReader::readCount()
+{
+    qint32 result = 0;
+    m_stream >> result;
+    if (result < 0)
+        m_stream.setStatus(QDataStream::ReadCorruptData);
+    return ok() ? result : 0;
+}
+
+template <class Item>
+std::shared_ptr<Item> ModelReader::readItem()
+{
+    QString name;
+    QStringList scope;
+    QString fileName;
+    qint32 startLine{};
+    qint32 startColumn{};
+    qint32 endLine{};
+    qint32 endColumn{};
+    m_stream >> name >> scope >> fileName >> startLine >> startColumn
+        >> endLine >> endColumn;
+    auto result = std::make_shared<Item>(m_model, name);
+    result->setScope(scope);
+    result->setFileName(fileName);
+    result->setStartPosition(startLine, startColumn);
+    result->setEndPosition(endLine, endColumn);
+    return result;
+}
+
+TypeInfo ModelReader::readTypeInfo()
+{
+    TypeInfo result;
+    QStringList qualifiedName;
+    bool constant{};
+    bool isVolatile{};
+    qint32 referenceType{};
+    bool functionPointer{};
+    QStringList arrayElements;
+    m_stream >> qualifiedName >> constant >> isVolatile >> referenceType
+        >> functionPointer >> arrayElements;
+    result.setQualifiedName(qualifiedName);
+    result.setConstant(constant);
+    result.setVolatile(isVolatile);
+    result.setReferenceType(ReferenceType(referenceType));
+    result.setFunctionPointer(functionPointer);
+    result.setArrayElements(arrayElements);
+    for (auto i = readCount(); i > 0 && ok(); --i) {
+        qint32 indirection{};
+        m_stream >> indirection;
+        result.addIndirection(Indirection(indirection));
+    }
+    for (auto i = readCount(); i > 0 && ok(); --i)
+        result.addArgument(readTypeInfo());
+    for (auto i = readCount(); i > 0 && ok(); --i)
+        result.addInstantiation(readTypeInfo());
+    return result;
+}
+
+TemplateParameterList ModelReader::readTemplateParameters()
+{
+    TemplateParameterList result;
+    for (auto i = readCount(); i > 0 && ok(); --i) {
+        auto p = readItem<_TemplateParameterModelItem>();
+        p->setType(readTypeInfo());
+        bool defaultValue{};
+        m_stream >> defaultValue;
+        p->setDefaultValue(defaultValue);
+        result.append(p);
+    }
+    return result;
+}
+
+void ModelReader::readScope(_ScopeModelItem *scope)
+{
+    QStringList enumsDeclarations;
+    m_stream >> enumsDeclarations;
+    for (const auto &d : std::as_const(enumsDeclarations))
+        scope->addEnumsDeclaration(d);
+
+    for (auto i = readCount(); i > 0 && ok(); --i)
+        scope->addClass(readClass());
+
+    for (auto i = readCount(); i > 0 && ok(); --i)
+        scope->addEnum(readEnum());
+
+    for (auto i = readCount(); i > 0 && ok(); --i)
+        scope->addFunction(readFunction());
+
+    for (auto i = readCount(); i > 0 && ok(); --i) {
+        auto t = readItem<_TypeDefModelItem>();
+        t->setType(readTypeInfo());
+        scope->addTypeDef(t);
+    }
+
+    for (auto i = readCount(); i > 0 && ok(); --i) {
+        auto a = readItem<_TemplateTypeAliasModelItem>();
+        for (const auto &p : readTemplateParameters())
+            a->addTemplateParameter(p);
+        a->setType(readTypeInfo());
+        scope->addTemplateTypeAlias(a);
+    }
+
+    for (auto i = readCount(); i > 0 && ok(); --i) {
+        auto v = readItem<_VariableModelItem>();
+        readMember(v.get());
+        scope->addVariable(v);
+    }
+}
+
+void ModelReader::readNamespace(_NamespaceModelItem *ns)
+{
+    readScope(ns);
+    qint32 type{};
+    m_stream >> type;
+    ns->setType(NamespaceType(type));
+    for (auto i = readCount(); i > 0 && ok(); --i) {
+        auto n = readItem<_NamespaceModelItem>();
+        readNamespace(n.get());
+        ns->addNamespace(n);
+    }
+}
+
+ClassModelItem ModelReader::readClass()
+{
+    auto result = readItem<_ClassModelItem>();
+    m_classes.append(result);
+    readScope(result.get());
+    for (auto i = readCount(); i > 0 && ok(); --i) {
+        QString name;
+        qint32 index{};
+        qint32 access{};
+        m_stream >> name >> index >> access;
+        m_pendingBases.append({result.get(), name, index, Access(access)});
+    }
+    for (auto i = readCount(); i > 0 && ok(); --i) {
+        QString className;
+        QString memberName;
+        qint32 access{};
+        m_stream >> className >> memberName >> access;
+        result->addUsingMember(className, memberName, Access(access));
+    }
+    result->setTemplateParameters(readTemplateParameters());
+    qint32 classType{};
+    QStringList propertyDeclarations;
+    bool isFinal{};
+    m_stream >> classType >> propertyDeclarations >> isFinal;
+    result->setClassType(CodeModel::ClassType(classType));
+    for (const auto &p : std::as_const(propertyDeclarations))
+        result->addPropertyDeclaration(p);
+    result->setFinal(isFinal);
+    return result;
+}
+
+void ModelReader::readMember(_MemberModelItem *member)
+{
+    bool isConstant{};
+    bool isVolatile{};
+    bool isStatic{};
+    bool isAuto{};
+    bool isFriend{};
+    bool isRegister{};
+    bool isExtern{};
+    bool isMutable{};
+    qint32 access{};
+    m_stream >> isConstant >> isVolatile >> isStatic >> isAuto >> isFriend
+        >> isRegister >> isExtern >> isMutable >> access;
+    member->setConstant(isConstant);
+    member->setVolatile(isVolatile);
+    member->setStatic(isStatic);
+    member->setAuto(isAuto);
+    member->setFriend(isFriend);
+    member->setRegister(isRegister);
+    member->setExtern(isExtern);
+    member->setMutable(isMutable);
+    member->setAccessPolicy(Access(access));
+    member->setTemplateParameters(readTemplateParameters());
+    member->setType(readTypeInfo());
+}
+
+FunctionModelItem ModelReader::readFunction()
+{
+    auto result = readItem<_FunctionModelItem>();
+    readMember(result.get());
+    for (auto i = readCount(); i > 0 && ok(); --i) {
+        auto a = readItem<_ArgumentModelItem>();
+        a->setType(readTypeInfo());
+        bool defaultValue{};
+        QString defaultValueExpression;
+        bool scopeResolution{};
+        m_stream >> defaultValue >> defaultValueExpression >> scopeResolution;
+        a->setDefaultValue(defaultValue);
+        a->setDefaultValueExpression(defaultValueExpression);
+        a->setScopeResolution(scopeResolution);
+        result->addArgument(a);
+    }
+    qint32 functionType{};
+    bool isDeleted{};
+    bool isVirtual{};
+    bool isOverride{};
+    bool isFinal{};
+    bool isDeprecated{};
+    bool isInline{};
+    bool isAbstract{};
+    bool isExplicit{};
+    bool isVariadics{};
+    bool isHiddenFriend{};
+    bool isInvokable{};
+    bool scopeResolution{};
+    qint32 exceptionSpecification{};
+    m_stream >> functionType >> isDeleted >> isVirtual >> isOverride >> isFinal
+        >> isDeprecated >> isInline >> isAbstract >> isExplicit >> isVariadics
+        >> isHiddenFriend >> isInvokable >> scopeResolution >> exceptionSpecification;
+    result->setFunctionType(CodeModel::FunctionType(functionType));
+    result->setDeleted(isDeleted);
+    result->setVirtual(isVirtual);
+    result->setOverride(isOverride);
+    result->setFinal(isFinal);
+    result->setDeprecated(isDeprecated);
+    result->setInline(isInline);
+    result->setAbstract(isAbstract);
+    result->setExplicit(isExplicit);
+    result->setVariadics(isVariadics);
+    result->setHiddenFriend(isHiddenFriend);
+    result->setInvokable(isInvokable);
+    result->setScopeResolution(scopeResolution);
+    result->setExceptionSpecification(ExceptionSpecification(exceptionSpecification));
+    return result;
+}
+
+EnumModelItem ModelReader::readEnum()
+{
+    auto result = readItem<_EnumModelItem>();
+    qint32 access{};
+    qint32 enumKind{};
+    bool deprecated{};
+    bool isSigned{};
+    m_stream >> access >> enumKind >> deprecated >> isSigned;
+    result->setAccessPolicy(Access(access));
+    result->setEnumKind(EnumKind(enumKind));
+    result->setDeprecated(deprecated);
+    result->setSigned(isSigned);
+    for (auto i = readCount(); i > 0 && ok(); --i) {
+        auto v = readItem<_EnumeratorModelItem>();
+        QString stringValue;
+        qint32 type{};
+        m_stream >> stringValue >> type;
+        v->setStringValue(stringValue);
+        EnumValue value;
+        if (type == EnumValue::Signed) {
+            qint64 signedValue{};
+            m_stream >> signedValue;
+            value.setValue(signedValue);
+        } else {
+            quint64 unsignedValue{};
+            m_stream >> unsignedValue;
+            value.setUnsignedValue(unsignedValue);
+        }
+        v->setValue(value);
+        bool deprecated{};
+        m_stream >> deprecated;
+        v->setDeprecated(deprecated);
+        result->addEnumerator(v);
+    }
+    return result;
+}
+
+} // namespace
+
+// ---------------------------------------------------------------------------
+
+bool CodeModelCache::writeModel(QIODevice *device, const FileModelItem &dom)
+{
+    QDataStream stream(device);
+    stream.setVersion(QDataStream::Qt_6_0);
+    ModelWriter(stream).write(dom);
+    return stream.status() == QDataStream::Ok;
+}
+
+FileModelItem CodeModelCache::readModel(QIODevice *device, CodeModel *model)
+{
+    QDataStream stream(device);
+    stream.setVersion(QDataStream::Qt_6_0);
+    return ModelReader(stream, model).read();
+}
+
+// The items keep a pointer to their model, which needs to outlive them.
+static CodeModel *cacheCodeModel()
+{
+    static CodeModel result;
+    return &result;
+}
+
+FileModelItem CodeModelCache::load(const QString &directory, const QByteArray &key,
+                                   QString *errorMessage)
+{
+    QFile file(cacheFileName(directory, key));
+    if (!file.exists())
+        return {};
+    if (!file.open(QIODevice::ReadOnly)) {
+        if (errorMessage != nullptr)
+            *errorMessage = file.errorString();
+        return {};
+    }
+    QDataStream stream(&file);
+    stream.setVersion(QDataStream::Qt_6_0);
+    quint32 magic{};
+    quint32 version{};
+    QByteArray fileKey;
+    stream >> magic >> version >> fileKey;
+    if (magic != cacheMagic || version != cacheVersion || fileKey != key)
+        return {};
+
+    qint32 headerCount{};
+    stream >> headerCount;
+    for (; headerCount > 0 && stream.status() == QDataStream::Ok; --headerCount) {
+        QString header;
+        QByteArray hash;
+        stream >> header >> hash;
+        if (fileHash(header) != hash)
+            return {}; // Header was modified
+    }
+    if (stream.status() != QDataStream::Ok)
+        return {};
+
+    auto result = readModel(&file, cacheCodeModel());
+    if (!result && errorMessage != nullptr)
+        *errorMessage = u"Corrupt code model cache file "_s + file.fileName();
+    return result;
+}
+
+bool CodeModelCache::save(const QString &directory, const QByteArray &key,
+                          const QStringList &headers, const FileModelItem &dom,
+                          QString *errorMessage)
+{
+    if (!QDir().mkpath(directory)) {
+        *errorMessage = u"Cannot create directory "_s + QDir::toNativeSeparators(directory);
+        return false;
+    }
+    QSaveFile file(cacheFileName(directory, key));
+    if (!file.open(QIODevice::WriteOnly)) {
+        *errorMessage = file.errorString();
+        return false;
+    }
+    QDataStream stream(&file);
+    stream.setVersion(QDataStream::Qt_6_0);
+    stream << cacheMagic << cacheVersion << key << qint32(headers.size());
+    for (const auto &header : headers)
+        stream << header << fileHash(header);
+    if (!writeModel(&file, dom) || !file.commit()) {
+        *errorMessage = file.errorString();
+        return false;
+    }
+    return true;
+}
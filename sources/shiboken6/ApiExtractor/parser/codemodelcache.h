@@ -0,0 +1,36 @@
+// Copyright (C) 2023 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only WITH Qt-GPL-exception-1.0
+
+#ifndef CODEMODELCACHE_H
+#define CODEMODELCACHE_H
+
+#include "codemodel_fwd.h"
+
+#include <QtCore/QByteArrayList>
+#include <QtCore/QStringList>
+
+QT_FORWARD_DECLARE_CLASS(QIODevice)
+
+// On-disk cache of the code model built from the clang parse. A cache file
+// is keyed by the clang arguments and records the headers seen by clang
+// with a hash of their contents, so that it is only used when none of the
+// headers changed.
+namespace CodeModelCache
+{
+// Compute the key from the clang arguments and additional settings
+// influencing the parse. The last argument is the main file, which is
+// typically a temporary file, so its contents are used instead of its name.
+QByteArray computeKey(const QByteArrayList &arguments, const QByteArrayList &settings);
+
+FileModelItem load(const QString &directory, const QByteArray &key,
+                   QString *errorMessage = nullptr);
+bool save(const QString &directory, const QByteArray &key,
+          const QStringList &headers, const FileModelItem &dom,
+          QString *errorMessage);
+
+// Serialization of the model only
+bool writeModel(QIODevice *device, const FileModelItem &dom);
+FileModelItem readModel(QIODevice *device, CodeModel *model);
+} // namespace CodeModelCache
+
+#endif // CODEMODELCACHE_H
@@ -7,6 +7,7 @@
 #include "qtcompat.h"
 
 #include <QtCore/QElapsedTimer>
+#include <QtCore/QMutex>
 #include <QtCore/QSet>
 #include <cstring>
 #include <cstdarg>
@@ -35,6 +36,7 @@ static QString m_prefix;
 static bool m_withinProgress = false;
 static int m_step_warning = 0;
 static QElapsedTimer m_timer;
+static QBasicMutex m_messageMutex; // Messages are also emitted by generator threads
 
 Q_LOGGING_CATEGORY(lcShiboken, "qt.shiboken")
 Q_LOGGING_CATEGORY(lcShibokenDoc, "qt.shiboken.doc")
@@ -101,6 +103,7 @@ void ReportHandler::setPrefix(const QString &p)
 
 void ReportHandler::messageOutput(QtMsgType type, const QMessageLogContext &context, const QString &text)
 {
+    QMutexLocker locker(&m_messageMutex);
     // Check for file location separator added by SourceLocation
     int fileLocationPos = text.indexOf(u":\t");
     if (type == QtWarningMsg) {
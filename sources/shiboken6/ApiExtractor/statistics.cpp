@@ -0,0 +1,186 @@
+// Copyright (C) 2023 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only WITH Qt-GPL-exception-1.0
+
+#include "statistics.h"
+
+#include <QtCore/QDir>
+#include <QtCore/QJsonArray>
+#include <QtCore/QJsonDocument>
+#include <QtCore/QJsonObject>
+#include <QtCore/QList>
+#include <QtCore/QSaveFile>
+
+#if defined(Q_OS_WIN)
+#  include <windows.h>
+#  include <psapi.h>
+#elif defined(Q_OS_UNIX)
+#  include <sys/resource.h>
+#endif
+
+#include <algorithm>
+#include <array>
+#include <iterator>
+#include <atomic>
+
+using namespace Qt::StringLiterals;
+
+struct PhaseTime
+{
+    QString name;
+    qint64 nsecs;
+};
+
+struct ClassTime
+{
+    QString generator;
+    QString className;
+    QString fileName;
+    qint64 nsecs;
+};
+
+static bool m_enabled = false;
+static QElapsedTimer m_totalTimer;
+static QElapsedTimer m_phaseTimer;
+static QString m_currentPhase;
+static QList<PhaseTime> m_phases;
+static QList<ClassTime> m_classTimes;
+// Incremented from the generator threads (--jobs)
+static std::array<std::atomic<qint64>, size_t(Statistics::Counter::Count)> m_counters{};
+static std::array<std::atomic<qint64>, size_t(Statistics::Timer::Count)> m_timers{};
+
+static const char *counterNames[] = {"findType", "findClass", "overloadData", "filesWritten"};
+static const char *timerNames[] = {"overloadData", "fileOutput"};
+
+static_assert(std::size(counterNames) == size_t(Statistics::Counter::Count));
+static_assert(std::size(timerNames) == size_t(Statistics::Timer::Count));
+
+static inline double msecs(qint64 nsecs)
+{
+    return double(nsecs) / 1000000.0;
+}
+
+bool Statistics::isEnabled()
+{
+    return m_enabled;
+}
+
+void Statistics::setEnabled(bool enabled)
+{
+    m_enabled = enabled;
+    if (enabled && !m_totalTimer.isValid())
+        m_totalTimer.start();
+}
+
+void Statistics::startPhase(const QString &name)
+{
+    if (!m_enabled)
+        return;
+    endPhase();
+    m_currentPhase = name;
+    m_phaseTimer.start();
+}
+
+void Statistics::endPhase()
+{
+    if (!m_enabled || m_currentPhase.isEmpty())
+        return;
+    m_phases.append({m_currentPhase, m_phaseTimer.nsecsElapsed()});
+    m_currentPhase.clear();
+}
+
+void Statistics::increment(Counter c)
+{
+    if (m_enabled)
+        m_counters[size_t(c)].fetch_add(1, std::memory_order_relaxed);
+}
+
+void Statistics::addTime(Timer t, qint64 nsecs)
+{
+    if (m_enabled)
+        m_timers[size_t(t)].fetch_add(nsecs, std::memory_order_relaxed);
+}
+
+void Statistics::addClassTime(const QString &generator, const QString &className,
+                              const QString &fileName, qint64 nsecs)
+{
+    if (m_enabled)
+        m_classTimes.append({generator, className, fileName, nsecs});
+}
+
+qint64 Statistics::peakMemory()
+{
+#if defined(Q_OS_WIN)
+    PROCESS_MEMORY_COUNTERS counters;
+    if (GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters)))
+        return qint64(counters.PeakWorkingSetSize / 1024);
+    return -1;
+#elif defined(Q_OS_UNIX)
+    struct rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) != 0)
+        return -1;
+#  if defined(Q_OS_DARWIN)
+    return qint64(usage.ru_maxrss / 1024); // bytes
+#  else
+    return qint64(usage.ru_maxrss); // KiB
+#  endif
+#else
+    return -1;
+#endif
+}
+
+static QJsonDocument toJson()
+{
+    QJsonArray phases;
+    for (const auto &p : std::as_const(m_phases))
+        phases.append(QJsonObject{{u"name"_s, p.name}, {u"ms"_s, msecs(p.nsecs)}});
+
+    QJsonObject timers;
+    for (size_t i = 0; i < m_timers.size(); ++i)
+        timers.insert(QLatin1StringView(timerNames[i]), msecs(m_timers[i].load()));
+
+    QJsonObject counters;
+    for (size_t i = 0; i < m_counters.size(); ++i)
+        counters.insert(QLatin1StringView(counterNames[i]), m_counters[i].load());
+
+    // Most expensive classes first
+    auto classTimes = m_classTimes;
+    std::stable_sort(classTimes.begin(), classTimes.end(),
+                     [](const ClassTime &c1, const ClassTime &c2) {
+                         return c1.nsecs > c2.nsecs;
+                     });
+    QJsonArray classes;
+    for (const auto &c : std::as_const(classTimes)) {
+        classes.append(QJsonObject{{u"generator"_s, c.generator},
+                                   {u"class"_s, c.className},
+                                   {u"file"_s, c.fileName},
+                                   {u"ms"_s, msecs(c.nsecs)}});
+    }
+
+    QJsonObject result{{u"totalMs"_s, msecs(m_totalTimer.nsecsElapsed())},
+                       {u"peakMemoryKiB"_s, Statistics::peakMemory()},
+                       {u"phases"_s, phases},
+                       {u"timers"_s, timers},
+                       {u"counters"_s, counters},
+                       {u"classes"_s, classes}};
+    return QJsonDocument(result);
+}
+
+bool Statistics::write(const QString &fileName, QString *errorMessage)
+{
+    if (!m_enabled)
+        return true;
+    endPhase();
+    QSaveFile file(fileName);
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Text)) {
+        *errorMessage = u"Cannot open \""_s + QDir::toNativeSeparators(fileName)
+                        + u"\" for writing: "_s + file.errorString();
+        return false;
+    }
+    file.write(toJson().toJson());
+    if (!file.commit()) {
+        *errorMessage = u"Failed to write \""_s + QDir::toNativeSeparators(fileName)
+                        + u"\": "_s + file.errorString();
+        return false;
+    }
+    return true;
+}
@@ -0,0 +1,84 @@
+// Copyright (C) 2023 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only WITH Qt-GPL-exception-1.0
+
+#ifndef STATISTICS_H
+#define STATISTICS_H
+
+#include <QtCore/QElapsedTimer>
+#include <QtCore/QString>
+
+/// Optional instrumentation of a generator run (--timing). It records the
+/// wall time of the phases, the generation time per class, accumulated times
+/// and counts of frequent operations and the peak memory usage, and writes
+/// them as JSON. All functions do nothing unless it is enabled.
+class Statistics
+{
+public:
+    enum class Counter
+    {
+        FindType,      // TypeDatabase::findType()
+        FindClass,     // class lookups by name or type entry
+        OverloadData,  // overload decisors built
+        FilesWritten,  // files changed by FileOut
+        Count
+    };
+
+    enum class Timer
+    {
+        OverloadData,  // building of overload decisors
+        FileOutput,    // comparing and writing of files (all threads)
+        Count
+    };
+
+    static bool isEnabled();
+    static void setEnabled(bool enabled);
+
+    /// Starts a phase, ending the current one.
+    static void startPhase(const QString &name);
+    static void endPhase();
+
+    static void increment(Counter c);
+    static void addTime(Timer t, qint64 nsecs);
+    static void addClassTime(const QString &generator, const QString &className,
+                             const QString &fileName, qint64 nsecs);
+
+    /// Returns the peak resident memory in KiB or -1 if it cannot be determined.
+    static qint64 peakMemory();
+
+    static bool write(const QString &fileName, QString *errorMessage);
+};
+
+/// Scoped phase
+class StatisticsPhase
+{
+public:
+    Q_DISABLE_COPY_MOVE(StatisticsPhase)
+
+    explicit StatisticsPhase(const QString &name) { Statistics::startPhase(name); }
+    ~StatisticsPhase() { Statistics::endPhase(); }
+};
+
+/// Scoped accumulated timer
+class StatisticsTimer
+{
+public:
+    Q_DISABLE_COPY_MOVE(StatisticsTimer)
+
+    explicit StatisticsTimer(Statistics::Timer t) : m_timer(t)
+    {
+        if (Statistics::isEnabled())
+            m_elapsed.start();
+    }
+
+    ~StatisticsTimer()
+    {
+        if (m_elapsed.isValid())
+            Statistics::addTime(m_timer, m_elapsed.nsecsElapsed());
+    }
+
+private:
+    Statistics::Timer m_timer;
+    QElapsedTimer m_elapsed;
+};
+
+#endif // STATISTICS_H
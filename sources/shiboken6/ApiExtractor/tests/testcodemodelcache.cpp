@@ -0,0 +1,122 @@
+// Copyright (C) 2023 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only WITH Qt-GPL-exception-1.0
+
+#include "testcodemodelcache.h"
+
+#include <abstractmetabuilder_p.h>
+#include <parser/codemodel.h>
+#include <parser/codemodelcache.h>
+
+#include <QtTest/QTest>
+#include <QtCore/QBuffer>
+#include <QtCore/QDebug>
+#include <QtCore/QDir>
+#include <QtCore/QFile>
+#include <QtCore/QTemporaryDir>
+
+static const char header[] = R"(
+namespace Ns {
+enum Color { Red, Green = 3 };
+class Base {
+public:
+    virtual ~Base();
+    virtual int value(int a, double b = 2.0) const = 0;
+};
+template <class T> class Holder { T m_value; };
+class Derived : public Base {
+public:
+    Derived(const char *name);
+    int value(int a, double b = 2.0) const override;
+    static Color color();
+    Holder<int> holder;
+};
+using IntHolder = Holder<int>;
+} // namespace Ns
+)";
+
+static QString modelToString(const FileModelItem &dom)
+{
+    QString result;
+    QDebug(&result) << dom.get();
+    return result;
+}
+
+static bool writeHeader(const QString &fileName, const QByteArray &contents)
+{
+    QFile file(fileName);
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Truncate))
+        return false;
+    file.write(contents);
+    return true;
+}
+
+void TestCodeModelCache::testRoundTrip()
+{
+    QTemporaryDir dir;
+    QVERIFY(dir.isValid());
+    const QString headerName = dir.filePath(QStringLiteral("header.h"));
+    QVERIFY(writeHeader(headerName, header));
+
+    const QByteArrayList arguments{QFile::encodeName(headerName)};
+    const FileModelItem dom =
+        AbstractMetaBuilderPrivate::buildDom(arguments, true, LanguageLevel::Default, 0);
+    QVERIFY(dom);
+
+    QBuffer buffer;
+    QVERIFY(buffer.open(QIODevice::WriteOnly));
+    QVERIFY(CodeModelCache::writeModel(&buffer, dom));
+    buffer.close();
+
+    CodeModel model;
+    QVERIFY(buffer.open(QIODevice::ReadOnly));
+    const FileModelItem restored = CodeModelCache::readModel(&buffer, &model);
+    QVERIFY(restored);
+    QCOMPARE(modelToString(restored), modelToString(dom));
+
+    // Base class links must point into the restored model
+    const auto ns = restored->findNamespace(QStringLiteral("Ns"));
+    QVERIFY(ns);
+    const auto derived = ns->findClass(QStringLiteral("Derived"));
+    QVERIFY(derived);
+    QCOMPARE(derived->baseClasses().size(), 1);
+    QCOMPARE(derived->baseClasses().constFirst().klass, ns->findClass(QStringLiteral("Base")));
+}
+
+void TestCodeModelCache::testCacheInvalidation()
+{
+    QTemporaryDir dir;
+    QVERIFY(dir.isValid());
+    const QString cacheDir = dir.filePath(QStringLiteral("cache"));
+    const QString headerName = dir.filePath(QStringLiteral("header.h"));
+    QVERIFY(writeHeader(headerName, header));
+    const QString mainName = dir.filePath(QStringLiteral("main.cpp"));
+    QVERIFY(writeHeader(mainName, "#include \"header.h\"\n"));
+
+    const QByteArrayList arguments{QFile::encodeName(mainName)};
+    const FileModelItem dom =
+        AbstractMetaBuilderPrivate::buildDom(arguments, true, LanguageLevel::Default, 0,
+                                             cacheDir);
+    QVERIFY(dom);
+    const QStringList cacheFiles = QDir(cacheDir).entryList(QDir::Files);
+    QCOMPARE(cacheFiles.size(), 1);
+
+    // Second run is served from the cache
+    const FileModelItem cached =
+        AbstractMetaBuilderPrivate::buildDom(arguments, true, LanguageLevel::Default, 0,
+                                             cacheDir);
+    QVERIFY(cached);
+    QCOMPARE(modelToString(cached), modelToString(dom));
+
+    // Changing the included header invalidates it
+    QVERIFY(writeHeader(headerName, "namespace Ns { class Other {}; }\n"));
+    const FileModelItem changed =
+        AbstractMetaBuilderPrivate::buildDom(arguments, true, LanguageLevel::Default, 0,
+                                             cacheDir);
+    QVERIFY(changed);
+    const auto ns = changed->findNamespace(QStringLiteral("Ns"));
+    QVERIFY(ns);
+    QVERIFY(ns->findClass(QStringLiteral("Other")));
+    QVERIFY(!ns->findClass(QStringLiteral("Derived")));
+}
+
+QTEST_APPLESS_MAIN(TestCodeModelCache)
@@ -0,0 +1,17 @@
+// Copyright (C) 2023 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only WITH Qt-GPL-exception-1.0
+
+#ifndef TESTCODEMODELCACHE_H
+#define TESTCODEMODELCACHE_H
+
+#include <QtCore/QObject>
+
+class TestCodeModelCache : public QObject
+{
+    Q_OBJECT
+private slots:
+    void testRoundTrip();
+    void testCacheInvalidation();
+};
+
+#endif
@@ -0,0 +1,72 @@
+// Copyright (C) 2023 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only WITH Qt-GPL-exception-1.0
+
+#include "teststatistics.h"
+#include "testutil.h"
+#include <abstractmetalang.h>
+#include <statistics.h>
+
+#include <QtTest/QTest>
+#include <QtCore/QFile>
+#include <QtCore/QJsonArray>
+#include <QtCore/QJsonDocument>
+#include <QtCore/QJsonObject>
+#include <QtCore/QTemporaryDir>
+
+using namespace Qt::StringLiterals;
+
+void TestStatistics::testStatistics()
+{
+    const char cppCode[] = "struct A { void f(int); };\nstruct B : public A {};\n";
+    const char xmlCode[] = R"(<typesystem package="Foo">
+    <primitive-type name='int'/>
+    <value-type name='A'/>
+    <value-type name='B'/>
+</typesystem>
+)";
+
+    Statistics::setEnabled(true);
+    QScopedPointer<AbstractMetaBuilder> builder(TestUtil::parse(cppCode, xmlCode));
+    QVERIFY(builder);
+    {
+        StatisticsPhase phase(u"Test phase"_s);
+        Statistics::addClassTime(u"Test generator"_s, u"A"_s, u"a_wrapper.cpp"_s, 2000000);
+        Statistics::addClassTime(u"Test generator"_s, u"B"_s, u"b_wrapper.cpp"_s, 5000000);
+    }
+
+    QTemporaryDir tempDir;
+    QVERIFY(tempDir.isValid());
+    const QString fileName = tempDir.filePath(u"timing.json"_s);
+    QString errorMessage;
+    QVERIFY2(Statistics::write(fileName, &errorMessage), qPrintable(errorMessage));
+    Statistics::setEnabled(false);
+
+    QFile file(fileName);
+    QVERIFY(file.open(QIODevice::ReadOnly));
+    QJsonParseError parseError;
+    const QJsonDocument document = QJsonDocument::fromJson(file.readAll(), &parseError);
+    QVERIFY2(!document.isNull(), qPrintable(parseError.errorString()));
+    const QJsonObject root = document.object();
+
+    QStringList phaseNames;
+    for (const auto &p : root.value(u"phases"_s).toArray())
+        phaseNames.append(p.toObject().value(u"name"_s).toString());
+    QVERIFY(phaseNames.contains(u"Parsing C++ headers"_s));
+    QVERIFY(phaseNames.contains(u"Building meta model"_s));
+    QCOMPARE(phaseNames.constLast(), u"Test phase"_s);
+
+    const QJsonObject counters = root.value(u"counters"_s).toObject();
+    QVERIFY(counters.value(u"findType"_s).toInteger() > 0);
+    QVERIFY(counters.value(u"findClass"_s).toInteger() > 0);
+
+    // Most expensive class first
+    const QJsonArray classes = root.value(u"classes"_s).toArray();
+    QCOMPARE(classes.size(), 2);
+    QCOMPARE(classes.at(0).toObject().value(u"class"_s).toString(), u"B"_s);
+    QCOMPARE(classes.at(0).toObject().value(u"ms"_s).toDouble(), 5.0);
+
+    QVERIFY(root.value(u"totalMs"_s).toDouble() > 0);
+    QVERIFY(root.contains(u"peakMemoryKiB"_s));
+}
+
+QTEST_APPLESS_MAIN(TestStatistics)
@@ -0,0 +1,16 @@
+// Copyright (C) 2023 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only WITH Qt-GPL-exception-1.0
+
+#ifndef TESTSTATISTICS_H
+#define TESTSTATISTICS_H
+
+#include <QtCore/QObject>
+
+class TestStatistics : public QObject
+{
+    Q_OBJECT
+private slots:
+    void testStatistics();
+};
+
+#endif
@@ -0,0 +1,168 @@
+// Copyright (C) 2023 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only WITH Qt-GPL-exception-1.0
+
+#include "testtypesystemsnapshot.h"
+#include <codesnip.h>
+#include <conditionalstreamreader.h>
+#include <complextypeentry.h>
+#include <reporthandler.h>
+#include <typedatabase.h>
+#include <typesystemsnapshot.h>
+
+#include <qtcompat.h>
+
+#include <QtCore/QDir>
+#include <QtCore/QFile>
+#include <QtCore/QHash>
+#include <QtCore/QTemporaryDir>
+#include <QtTest/QTest>
+
+using namespace Qt::StringLiterals;
+
+static const char dependencyXml[] = R"(<typesystem package="Dep">
+    <?if keyword1?>
+    <value-type name="A"/>
+    <?endif?>
+    <value-type name="B">
+        <inject-code class="target" file="dep_glue.cpp" snippet="b"/>
+    </value-type>
+</typesystem>
+)";
+
+static const char glueCode[] = R"(// @snippet b
+callB();
+// @snippet b
+)";
+
+static const char mainXml[] = R"(<typesystem package="Main">
+    <load-typesystem name="dep.xml" generate="no"/>
+</typesystem>
+)";
+
+static bool writeFile(const QString &fileName, const char *contents)
+{
+    QFile file(fileName);
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Text))
+        return false;
+    file.write(contents);
+    return true;
+}
+
+// Parse the main typesystem loading the dependency and check its entries
+static bool parseMain(const QString &directory, const QString &snapshotDirectory,
+                      const QStringList &keywords)
+{
+    auto *db = TypeDatabase::instance(true);
+    db->addTypesystemPath(directory);
+    db->setTypesystemKeywords(keywords);
+    db->setSnapshotDirectory(snapshotDirectory);
+    if (!db->parseFile(directory + u"/main.xml"_s))
+        return false;
+    if (keywords.contains(u"keyword1"_s) != (db->findComplexType(u"A"_s) != nullptr))
+        return false;
+    const auto b = db->findComplexType(u"B"_s);
+    if (!b || b->codeSnips().size() != 1)
+        return false;
+    return b->codeSnips().constFirst().code().contains(u"callB();"_s);
+}
+
+void TestTypeSystemSnapshot::testSnapshot()
+{
+    ReportHandler::setSilent(true);
+    QTemporaryDir dir;
+    QVERIFY(dir.isValid());
+    const QString path = dir.path();
+    QVERIFY(writeFile(path + u"/dep.xml"_s, dependencyXml));
+    QVERIFY(writeFile(path + u"/dep_glue.cpp"_s, glueCode));
+    QVERIFY(writeFile(path + u"/main.xml"_s, mainXml));
+    const QString snapshotDirectory = path + u"/snapshots"_s;
+    const QStringList keywords{u"keyword1"_s};
+
+    // First run records the snapshots of both files
+    QVERIFY(parseMain(path, snapshotDirectory, keywords));
+    const QStringList conditions = TypeDatabase::instance()->typesystemKeywords();
+    const QString dependencySnapshot =
+        TypeSystemSnapshot::fileNameFor(snapshotDirectory, path + u"/dep.xml"_s, conditions);
+    QVERIFY(QFile::exists(dependencySnapshot));
+
+    QString errorMessage;
+    auto snapshot = TypeSystemSnapshot::load(dependencySnapshot, path + u"/dep.xml"_s,
+                                             conditions, &errorMessage);
+    QVERIFY2(snapshot, qPrintable(errorMessage));
+    QVERIFY(!snapshot->xml().contains("<?if"));
+    QVERIFY(snapshot->snippet(QDir(path).absoluteFilePath(u"dep_glue.cpp"_s), u"b"_s).has_value());
+
+    // Second run uses it
+    QVERIFY(parseMain(path, snapshotDirectory, keywords));
+
+    // Different keywords use a different snapshot
+    QVERIFY(parseMain(path, snapshotDirectory, {}));
+    QCOMPARE(QDir(snapshotDirectory).entryList({u"dep_*.tss"_s}, QDir::Files).size(), 2);
+
+    // A changed snippet file invalidates the snapshot
+    QVERIFY(writeFile(path + u"/dep_glue.cpp"_s, "// changed\n"));
+    snapshot = TypeSystemSnapshot::load(dependencySnapshot, path + u"/dep.xml"_s,
+                                        conditions, &errorMessage);
+    QVERIFY(!snapshot);
+}
+
+static const char layoutXml[] = R"(<?xml version="1.0"?>
+<!DOCTYPE typesystem SYSTEM "typesystem.dtd">
+<typesystem package="Layout">
+    <!-- A comment
+         spanning lines -->
+    <?if !keyword1?>
+    <value-type name="Skipped"/>
+    <?endif?>
+    <value-type
+        name="A"/>
+    <value-type name="B">&external;</value-type>
+    <value-type name="C"/>
+</typesystem>
+)";
+
+// Element name attribute -> line number
+using LineHash = QHash<QString, qint64>;
+
+static void recordLine(const ConditionalStreamReader &reader, LineHash *lines)
+{
+    if (reader.tokenType() == QXmlStreamReader::StartElement) {
+        const auto name = reader.attributes().value(u"name"_s);
+        if (!name.isEmpty())
+            lines->insert(name.toString(), reader.lineNumber());
+    }
+}
+
+// The snapshot keeps the line numbers for diagnostics and the references
+// to unresolved entities.
+void TestTypeSystemSnapshot::testLayout()
+{
+    TypeSystemSnapshot snapshot(u"layout.xml"_s, {u"keyword1"_s});
+    snapshot.startRecording();
+    LineHash originalLines;
+    ConditionalStreamReader reader(QString::fromUtf8(layoutXml));
+    reader.setConditions({u"keyword1"_s});
+    while (!reader.atEnd()) {
+        reader.readNext();
+        QVERIFY2(!reader.hasError(), qPrintable(reader.errorString()));
+        snapshot.recordToken(reader);
+        recordLine(reader, &originalLines);
+    }
+    snapshot.finishRecording();
+    QCOMPARE(originalLines.size(), 3);
+
+    LineHash snapshotLines;
+    QStringList entityReferences;
+    ConditionalStreamReader replay(QString::fromUtf8(snapshot.xml()));
+    while (!replay.atEnd()) {
+        replay.readNext();
+        QVERIFY2(!replay.hasError(), qPrintable(replay.errorString()));
+        recordLine(replay, &snapshotLines);
+        if (replay.tokenType() == QXmlStreamReader::EntityReference)
+            entityReferences.append(replay.name().toString());
+    }
+    QCOMPARE(snapshotLines, originalLines);
+    QCOMPARE(entityReferences, QStringList{u"external"_s});
+}
+
+QTEST_APPLESS_MAIN(TestTypeSystemSnapshot)
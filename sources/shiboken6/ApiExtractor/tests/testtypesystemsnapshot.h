@@ -0,0 +1,17 @@
+// Copyright (C) 2023 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only WITH Qt-GPL-exception-1.0
+
+#ifndef TESTTYPESYSTEMSNAPSHOT_H
+#define TESTTYPESYSTEMSNAPSHOT_H
+
+#include <QtCore/QObject>
+
+class TestTypeSystemSnapshot : public QObject
+{
+    Q_OBJECT
+private slots:
+    void testSnapshot();
+    void testLayout();
+};
+
+#endif
@@ -18,8 +18,10 @@
 #include "primitivetypeentry.h"
 #include "pythontypeentry.h"
 #include "smartpointertypeentry.h"
+#include "statistics.h"
 #include "typedefentry.h"
 #include "typesystemtypeentry.h"
+#include "typesystemsnapshot.h"
 #include "varargstypeentry.h"
 #include "voidtypeentry.h"
 #include "conditionalstreamreader.h"
@@ -31,6 +33,7 @@
 
 #include <QtCore/QBuffer>
 #include <QtCore/QFile>
+#include <QtCore/QFileInfo>
 #include <QtCore/QDebug>
 #include <QtCore/QDir>
 #include <QtCore/QPair>
@@ -114,6 +117,8 @@ struct TypeDatabasePrivate
                    const QString &filename, const QString &currentPath, bool generate);
     bool prepareParsing(QFile &file, const QString &origFileName,
                         const QString &currentPath = {});
+    bool parseFileWithSnapshot(const TypeDatabaseParserContextPtr &context,
+                               QFile *file, bool generate);
 
     QString modifiedTypesystemFilepath(const QString& tsFile,
                                        const QString &currentPath) const;
@@ -157,6 +162,7 @@ struct TypeDatabasePrivate
 
     QStringList m_typesystemPaths;
     QStringList m_typesystemKeywords;
+    QString m_snapshotDirectory;
     QHash<QString, bool> m_parsedTypesystemFiles;
 
     QList<TypeRejection> m_rejections;
@@ -203,10 +209,8 @@ using IntTypeNormalizationEntries = QList<IntTypeNormalizationEntry>;
 
 static const IntTypeNormalizationEntries &intTypeNormalizationEntries()
 {
-    static IntTypeNormalizationEntries result;
-    static bool firstTime = true;
-    if (firstTime) {
-        firstTime = false;
+    static const IntTypeNormalizationEntries result = [] {
+        IntTypeNormalizationEntries entries;
         for (auto t : {"char", "short", "int", "long"}) {
             const QString intType = QLatin1StringView(t);
             if (!TypeDatabase::instance()->findType(u'u' + intType)) {
@@ -214,10 +218,11 @@ static const IntTypeNormalizationEntries &intTypeNormalizationEntries()
                 entry.replacement = QStringLiteral("unsigned ") + intType;
                 entry.regex.setPattern(QStringLiteral("\\bu") + intType + QStringLiteral("\\b"));
                 Q_ASSERT(entry.regex.isValid());
-                result.append(entry);
+                entries.append(entry);
             }
         }
-    }
+        return entries;
+    }();
     return result;
 }
 
@@ -313,6 +318,16 @@ void TypeDatabase::setTypesystemKeywords(const QStringList &keywords)
     d->m_typesystemKeywords = keywords;
 }
 
+QString TypeDatabase::snapshotDirectory() const
+{
+    return d->m_snapshotDirectory;
+}
+
+void TypeDatabase::setSnapshotDirectory(const QString &directory)
+{
+    d->m_snapshotDirectory = directory;
+}
+
 QStringList TypeDatabase::typesystemKeywords() const
 {
     QStringList result = d->m_typesystemKeywords;
@@ -446,6 +461,7 @@ TypeEntryPtr TypeDatabase::findType(const QString& name) const
 
 TypeEntryPtr TypeDatabasePrivate::findType(const QString& name) const
 {
+    Statistics::increment(Statistics::Counter::FindType);
     const auto entries = findTypeRange(name);
     for (const auto &entry : entries) {
         if (useType(entry))
@@ -1001,11 +1017,60 @@ bool TypeDatabasePrivate::parseFile(const TypeDatabaseParserContextPtr &context,
     if (!prepareParsing(file, filename, currentPath))
         return false;
 
-    const bool ok = parseFile(context, &file, generate);
+    const bool ok = m_snapshotDirectory.isEmpty()
+        ? parseFile(context, &file, generate)
+        : parseFileWithSnapshot(context, &file, generate);
     m_parsedTypesystemFiles[filepath] = ok;
     return ok;
 }
 
+// Typesystem files loaded as dependencies of another module are parsed
+// from a snapshot when available. Otherwise, a snapshot is recorded.
+bool TypeDatabasePrivate::parseFileWithSnapshot(const TypeDatabaseParserContextPtr &context,
+                                                QFile *file, bool generate)
+{
+    const QString fileName = QFileInfo(*file).absoluteFilePath();
+    const QStringList conditions = context->db->typesystemKeywords();
+    const QString snapshotFile =
+        TypeSystemSnapshot::fileNameFor(m_snapshotDirectory, fileName, conditions);
+    QString errorMessage;
+    std::unique_ptr<TypeSystemSnapshot> snapshot;
+    if (!generate)
+        snapshot = TypeSystemSnapshot::load(snapshotFile, fileName, conditions, &errorMessage);
+    if (!errorMessage.isEmpty())
+        qCWarning(lcShiboken, "%s", qPrintable(errorMessage));
+
+    QBuffer buffer;
+    const bool fromSnapshot = bool(snapshot);
+    if (fromSnapshot) {
+        buffer.setData(snapshot->xml());
+        buffer.open(QIODevice::ReadOnly);
+        if (ReportHandler::isDebug(ReportHandler::MediumDebug))
+            qCInfo(lcShiboken, "Using typesystem snapshot %s", qPrintable(snapshotFile));
+    } else {
+        snapshot = std::make_unique<TypeSystemSnapshot>(fileName, conditions);
+        snapshot->startRecording();
+    }
+
+    ConditionalStreamReader reader(fromSnapshot ? static_cast<QIODevice *>(&buffer) : file);
+    reader.setConditions(conditions);
+    TypeSystemParser handler(context, generate);
+    handler.setFileName(fileName);
+    handler.setSnapshot(snapshot.get());
+    if (!handler.parse(reader)) {
+        qCWarning(lcShiboken, "%s", qPrintable(handler.errorString()));
+        return false;
+    }
+
+    if (!fromSnapshot) {
+        snapshot->finishRecording();
+        if (!snapshot->save(snapshotFile, &errorMessage))
+            qCWarning(lcShiboken, "Unable to write typesystem snapshot: %s",
+                      qPrintable(errorMessage));
+    }
+    return true;
+}
+
 bool TypeDatabase::parseFile(QIODevice *device, bool generate)
 {
     return d->parseFile(device, this, generate);
@@ -1016,7 +1081,12 @@ bool TypeDatabasePrivate::parseFile(QIODevice *device, TypeDatabase *db, bool ge
     const auto context = std::make_shared<TypeDatabaseParserContext>();
     context->db = db;
 
-    if (!parseFile(context, device, generate))
+    // Record a snapshot of the typesystem of the module being generated
+    auto *file = qobject_cast<QFile *>(device);
+    const bool ok = file != nullptr && !m_snapshotDirectory.isEmpty()
+        ? parseFileWithSnapshot(context, file, generate)
+        : parseFile(context, device, generate);
+    if (!ok)
         return false;
 
     addBuiltInPrimitiveTypes();
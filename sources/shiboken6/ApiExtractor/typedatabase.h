@@ -82,6 +82,10 @@ public:
     void setTypesystemKeywords(const QStringList &keywords);
     QStringList typesystemKeywords() const;
 
+    /// Directory for snapshots of parsed typesystem files (see TypeSystemSnapshot)
+    QString snapshotDirectory() const;
+    void setSnapshotDirectory(const QString &directory);
+
     IncludeList extraIncludes(const QString &className) const;
 
     const QStringList &systemIncludes() const;
@@ -34,6 +34,7 @@
 #include "qtcompat.h"
 
 #include <QtCore/QDebug>
+#include <QtCore/QMutex>
 #include <QtCore/QRegularExpression>
 #include <QtCore/QSet>
 #include <QtCore/QVarLengthArray>
@@ -316,33 +317,45 @@ QString TypeEntry::name() const
     return m_d->m_name;
 }
 
+// The cached names are filled on demand, also by the generator threads
+// (--jobs).
+static QBasicMutex cachedNameMutex;
+
 // Build the C++ name excluding any inline namespaces
 // ("std::__1::shared_ptr" -> "std::shared_ptr"
 QString TypeEntryPrivate::shortName() const
 {
-    if (m_cachedShortName.isEmpty()) {
-        QVarLengthArray<TypeEntryCPtr > parents;
-        bool foundInlineNamespace = false;
-        for (auto p = m_parent; p != nullptr && p->type() != TypeEntry::TypeSystemType; p = p->parent()) {
-            if (p->type() == TypeEntry::NamespaceType
-                && std::static_pointer_cast<const NamespaceTypeEntry>(p)->isInlineNamespace()) {
-                foundInlineNamespace = true;
-            } else {
-                parents.append(p);
-            }
-        }
-        if (foundInlineNamespace) {
-            m_cachedShortName.reserve(m_name.size());
-            for (auto i = parents.size() - 1; i >= 0; --i) {
-                m_cachedShortName.append(parents.at(i)->entryName());
-                m_cachedShortName.append(u"::"_s);
-            }
-            m_cachedShortName.append(m_entryName);
+    {
+        QMutexLocker locker(&cachedNameMutex);
+        if (!m_cachedShortName.isEmpty())
+            return m_cachedShortName;
+    }
+
+    QVarLengthArray<TypeEntryCPtr > parents;
+    bool foundInlineNamespace = false;
+    for (auto p = m_parent; p != nullptr && p->type() != TypeEntry::TypeSystemType; p = p->parent()) {
+        if (p->type() == TypeEntry::NamespaceType
+            && std::static_pointer_cast<const NamespaceTypeEntry>(p)->isInlineNamespace()) {
+            foundInlineNamespace = true;
         } else {
-            m_cachedShortName = m_name;
+            parents.append(p);
+        }
+    }
+    QString result;
+    if (foundInlineNamespace) {
+        result.reserve(m_name.size());
+        for (auto i = parents.size() - 1; i >= 0; --i) {
+            result.append(parents.at(i)->entryName());
+            result.append(u"::"_s);
         }
+        result.append(m_entryName);
+    } else {
+        result = m_name;
     }
-    return m_cachedShortName;
+
+    QMutexLocker locker(&cachedNameMutex);
+    m_cachedShortName = result;
+    return result;
 }
 
 QString TypeEntry::shortName() const
@@ -413,9 +426,15 @@ QString TypeEntry::targetLangApiName() const
 
 QString TypeEntry::targetLangName() const
 {
-    if (m_d->m_cachedTargetLangName.isEmpty())
-        m_d->m_cachedTargetLangName = buildTargetLangName();
-    return m_d->m_cachedTargetLangName;
+    {
+        QMutexLocker locker(&cachedNameMutex);
+        if (!m_d->m_cachedTargetLangName.isEmpty())
+            return m_d->m_cachedTargetLangName;
+    }
+    const QString result = buildTargetLangName();
+    QMutexLocker locker(&cachedNameMutex);
+    m_d->m_cachedTargetLangName = result;
+    return result;
 }
 
 void TypeEntry::setTargetLangName(const QString &n)
@@ -505,13 +524,18 @@ TypeEntryPrivate *TypeEntry::d_func()
 
 QString TypeEntry::targetLangEntryName() const
 {
-    if (m_d->m_cachedTargetLangEntryName.isEmpty()) {
-        m_d->m_cachedTargetLangEntryName = targetLangName();
-        const int lastDot = m_d->m_cachedTargetLangEntryName.lastIndexOf(u'.');
-        if (lastDot != -1)
-            m_d->m_cachedTargetLangEntryName.remove(0, lastDot + 1);
+    {
+        QMutexLocker locker(&cachedNameMutex);
+        if (!m_d->m_cachedTargetLangEntryName.isEmpty())
+            return m_d->m_cachedTargetLangEntryName;
     }
-    return m_d->m_cachedTargetLangEntryName;
+    QString result = targetLangName();
+    const int lastDot = result.lastIndexOf(u'.');
+    if (lastDot != -1)
+        result.remove(0, lastDot + 1);
+    QMutexLocker locker(&cachedNameMutex);
+    m_d->m_cachedTargetLangEntryName = result;
+    return result;
 }
 
 QString TypeEntry::targetLangPackage() const
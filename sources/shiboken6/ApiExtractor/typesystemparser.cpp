@@ -24,6 +24,7 @@
 #include "reporthandler.h"
 #include "sourcelocation.h"
 #include "conditionalstreamreader.h"
+#include "typesystemsnapshot.h"
 
 #include "qtcompat.h"
 
@@ -588,13 +589,16 @@ public:
 
     QString resolveUndeclaredEntity(const QString &name) override;
 
+    const QStringList &readFiles() const { return m_readFiles; }
+
 private:
-    QString readFile(const QString &entityName, QString *errorMessage) const;
+    QString readFile(const QString &entityName, QString *errorMessage);
 
     const QString m_currentPath;
+    QStringList m_readFiles;
 };
 
-QString TypeSystemEntityResolver::readFile(const QString &entityName, QString *errorMessage) const
+QString TypeSystemEntityResolver::readFile(const QString &entityName, QString *errorMessage)
 {
     QString fileName = entityName;
     if (!fileName.contains(u'.'))
@@ -612,6 +616,7 @@ QString TypeSystemEntityResolver::readFile(const QString &entityName, QString *e
         *errorMessage = msgCannotOpenForReading(file);
         return QString();
     }
+    m_readFiles.append(path);
     QString result = QString::fromUtf8(file.readAll()).trimmed();
     // Remove license header comments on which QXmlStreamReader chokes
     if (result.startsWith(u"<!--")) {
@@ -796,7 +801,9 @@ bool TypeSystemParser::parse(ConditionalStreamReader &reader)
 
 bool TypeSystemParser::parseXml(ConditionalStreamReader &reader)
 {
-    const QString fileName = readerFileName(reader);
+    QString fileName = readerFileName(reader);
+    if (fileName.isEmpty())
+        fileName = m_fileName;
     if (!fileName.isEmpty()) {
         QFileInfo fi(fileName);
         m_currentPath = fi.absolutePath();
@@ -805,8 +812,12 @@ bool TypeSystemParser::parseXml(ConditionalStreamReader &reader)
     m_entityResolver.reset(new TypeSystemEntityResolver(m_currentPath));
     reader.setEntityResolver(m_entityResolver.data());
 
+    const bool record = m_snapshot != nullptr && m_snapshot->isRecording();
     while (!reader.atEnd()) {
-        switch (reader.readNext()) {
+        const auto tokenType = reader.readNext();
+        if (record)
+            m_snapshot->recordToken(reader);
+        switch (tokenType) {
         case QXmlStreamReader::NoToken:
         case QXmlStreamReader::Invalid:
             m_error = msgReaderError(reader, reader.errorString());
@@ -846,6 +857,10 @@ bool TypeSystemParser::parseXml(ConditionalStreamReader &reader)
             break;
         }
     }
+    if (record) {
+        for (const auto &file : m_entityResolver->readFiles())
+            m_snapshot->addDependency(file);
+    }
     return true;
 }
 
@@ -2930,6 +2945,31 @@ bool TypeSystemParser::parseParentOwner(const ConditionalStreamReader &,
     return true;
 }
 
+bool TypeSystemParser::readSnippetFromFile(const QString &resolved, const QString &fileName,
+                                           const QString &snippetLabel,
+                                           std::optional<QString> *code)
+{
+    if (!QFile::exists(resolved)) {
+        m_error = u"File for inject code not exist: "_s
+            + QDir::toNativeSeparators(fileName);
+        return false;
+    }
+    QFile codeFile(resolved);
+    if (!codeFile.open(QIODevice::Text | QIODevice::ReadOnly)) {
+        m_error = msgCannotOpenForReading(codeFile);
+        return false;
+    }
+    *code = extractSnippet(QString::fromUtf8(codeFile.readAll()), snippetLabel);
+    codeFile.close();
+    if (!code->has_value()) {
+        m_error = msgCannotFindSnippet(resolved, snippetLabel);
+        return false;
+    }
+    if (m_snapshot != nullptr && m_snapshot->isRecording())
+        m_snapshot->addSnippet(resolved, snippetLabel, code->value());
+    return true;
+}
+
 bool TypeSystemParser::readFileSnippet(QXmlStreamAttributes *attributes, CodeSnip *snip)
 {
     QString fileName;
@@ -2945,20 +2985,11 @@ bool TypeSystemParser::readFileSnippet(QXmlStreamAttributes *attributes, CodeSni
     if (fileName.isEmpty())
         return true;
     const QString resolved = m_context->db->modifiedTypesystemFilepath(fileName, m_currentPath);
-    if (!QFile::exists(resolved)) {
-        m_error = u"File for inject code not exist: "_s
-            + QDir::toNativeSeparators(fileName);
-        return false;
-    }
-    QFile codeFile(resolved);
-    if (!codeFile.open(QIODevice::Text | QIODevice::ReadOnly)) {
-        m_error = msgCannotOpenForReading(codeFile);
-        return false;
-    }
-    const auto codeOptional = extractSnippet(QString::fromUtf8(codeFile.readAll()), snippetLabel);
-    codeFile.close();
-    if (!codeOptional.has_value()) {
-        m_error = msgCannotFindSnippet(resolved, snippetLabel);
+    std::optional<QString> codeOptional;
+    if (m_snapshot != nullptr && !m_snapshot->isRecording())
+        codeOptional = m_snapshot->snippet(resolved, snippetLabel);
+    if (!codeOptional.has_value() && !readSnippetFromFile(resolved, fileName,
+                                                          snippetLabel, &codeOptional)) {
         return false;
     }
 
@@ -15,6 +15,7 @@
 #include <QtCore/QScopedPointer>
 
 #include <memory>
+#include <optional>
 
 QT_FORWARD_DECLARE_CLASS(QVersionNumber)
 QT_FORWARD_DECLARE_CLASS(QXmlStreamAttributes)
@@ -23,6 +24,7 @@ QT_FORWARD_DECLARE_CLASS(QXmlStreamReader)
 class ConditionalStreamReader;
 
 class TypeSystemEntityResolver;
+class TypeSystemSnapshot;
 class TypeDatabase;
 
 class FlagsTypeEntry;
@@ -145,6 +147,11 @@ public:
 
     QString errorString() const { return m_error; }
 
+    // File name to be used when parsing from a snapshot in memory
+    void setFileName(const QString &fileName) { m_fileName = fileName; }
+    // Snapshot to be recorded or to take code snippets from
+    void setSnapshot(TypeSystemSnapshot *snapshot) { m_snapshot = snapshot; }
+
 private:
     bool parseXml(ConditionalStreamReader &reader);
     bool setupSmartPointerInstantiations();
@@ -244,7 +251,9 @@ private:
                               QXmlStreamAttributes *);
      bool parseParentOwner(const ConditionalStreamReader &, StackElement topElement,
                            QXmlStreamAttributes *);
-     bool readFileSnippet(QXmlStreamAttributes *attributes, CodeSnip *snip);
+     bool readSnippetFromFile(const QString &resolved, const QString &fileName,
+                             const QString &snippetLabel, std::optional<QString> *code);
+    bool readFileSnippet(QXmlStreamAttributes *attributes, CodeSnip *snip);
      bool parseInjectCode(const ConditionalStreamReader &, StackElement topElement, QXmlStreamAttributes *);
      bool parseInclude(const ConditionalStreamReader &, StackElement topElement,
                        const TypeEntryPtr &entry, QXmlStreamAttributes *);
@@ -278,7 +287,9 @@ private:
     QString m_currentSignature;
     QString m_currentPath;
     QString m_currentFile;
+    QString m_fileName;
     QScopedPointer<TypeSystemEntityResolver> m_entityResolver;
+    TypeSystemSnapshot *m_snapshot = nullptr;
 };
 
 #endif // TYPESYSTEMPARSER_H
@@ -0,0 +1,241 @@
+// Copyright (C) 2023 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only WITH Qt-GPL-exception-1.0
+
+#include "typesystemsnapshot.h"
+#include "conditionalstreamreader.h"
+#include "messages.h"
+
+#include <QtCore/QCryptographicHash>
+#include <QtCore/QDataStream>
+#include <QtCore/QDateTime>
+#include <QtCore/QDir>
+#include <QtCore/QFile>
+#include <QtCore/QFileInfo>
+#include <QtCore/QSaveFile>
+#include <QtCore/QXmlStreamWriter>
+
+#include <algorithm>
+
+using namespace Qt::StringLiterals;
+
+static constexpr quint32 snapshotMagic = 0x54535353; // "TSSS"
+static constexpr quint32 snapshotVersion = 2;
+
+TypeSystemSnapshot::TypeSystemSnapshot(const QString &typeSystemFile,
+                                       const QStringList &conditions) :
+    m_typeSystemFile(typeSystemFile),
+    m_conditions(conditions)
+{
+}
+
+TypeSystemSnapshot::~TypeSystemSnapshot() = default;
+
+void TypeSystemSnapshot::startRecording()
+{
+    m_xml.clear();
+    m_buffer.setBuffer(&m_xml);
+    m_buffer.open(QIODevice::WriteOnly);
+    m_writer.reset(new QXmlStreamWriter(&m_buffer));
+    m_writer->writeStartDocument();
+    m_line = 1;
+    addDependency(m_typeSystemFile);
+}
+
+// Write the tokens in effect after conditional processing. Comments and
+// processing instructions are dropped; resolved entities have been expanded
+// while references to unresolved entities are kept along with the DTD.
+// The line structure of the file is kept so that diagnostics issued when
+// replaying the snapshot report the line numbers of the original file.
+void TypeSystemSnapshot::recordToken(const ConditionalStreamReader &reader)
+{
+    const qint64 line = reader.lineNumber();
+    switch (reader.tokenType()) {
+    case QXmlStreamReader::DTD: {
+        const auto text = reader.text();
+        const auto newLines = text.count(u'\n');
+        padToLine(line - newLines);
+        m_writer->writeDTD(text.toString());
+        m_line += newLines;
+    }
+        break;
+    case QXmlStreamReader::StartElement:
+        padToLine(line);
+        m_writer->writeStartElement(reader.qualifiedName().toString());
+        m_writer->writeAttributes(reader.attributes());
+        break;
+    case QXmlStreamReader::EndElement:
+        padToLine(line);
+        m_writer->writeEndElement();
+        break;
+    case QXmlStreamReader::EntityReference:
+        padToLine(line);
+        m_writer->writeEntityReference(reader.name().toString());
+        break;
+    case QXmlStreamReader::Characters:
+        if (reader.isWhitespace()) {
+            // Whitespace takes up or gives back the lines of dropped tokens
+            // and of expanded entities, whose newlines the reader does not count.
+            const auto text = reader.text();
+            const qint64 newLines = std::max(line - m_line, qint64(0));
+            m_writer->writeCharacters(QString(newLines, u'\n')
+                                      + text.sliced(text.lastIndexOf(u'\n') + 1));
+            m_line += newLines;
+        } else {
+            const auto text = reader.text();
+            const auto newLines = text.count(u'\n');
+            padToLine(line - newLines);
+            m_writer->writeCharacters(text.toString());
+            m_line += newLines;
+        }
+        break;
+    default:
+        break;
+    }
+}
+
+// Insert a comment consisting of newlines to move the next token to a line
+void TypeSystemSnapshot::padToLine(qint64 line)
+{
+    if (line > m_line) {
+        m_writer->writeComment(QString(line - m_line, u'\n'));
+        m_line = line;
+    }
+}
+
+void TypeSystemSnapshot::addDependency(const QString &fileName)
+{
+    const QFileInfo fi(fileName);
+    const QString path = fi.absoluteFilePath();
+    for (const auto &d : std::as_const(m_dependencies)) {
+        if (d.fileName == path)
+            return;
+    }
+    m_dependencies.append({path, fi.size(),
+                           fi.lastModified().toMSecsSinceEpoch()});
+}
+
+QString TypeSystemSnapshot::snippetKey(const QString &fileName, const QString &label)
+{
+    return fileName + u'\n' + label;
+}
+
+void TypeSystemSnapshot::addSnippet(const QString &fileName, const QString &label,
+                                    const QString &code)
+{
+    addDependency(fileName);
+    m_snippets.insert(snippetKey(fileName, label), code);
+}
+
+std::optional<QString> TypeSystemSnapshot::snippet(const QString &fileName,
+                                                   const QString &label) const
+{
+    const auto it = m_snippets.constFind(snippetKey(fileName, label));
+    if (it == m_snippets.constEnd())
+        return std::nullopt;
+    return it.value();
+}
+
+void TypeSystemSnapshot::finishRecording()
+{
+    if (!m_writer)
+        return;
+    m_writer->writeEndDocument();
+    m_writer.reset();
+    m_buffer.close();
+}
+
+bool TypeSystemSnapshot::isUpToDate(const Dependency &d)
+{
+    const QFileInfo fi(d.fileName);
+    return fi.isFile() && fi.size() == d.size
+        && fi.lastModified().toMSecsSinceEpoch() == d.lastModified;
+}
+
+bool TypeSystemSnapshot::save(const QString &fileName, QString *errorMessage) const
+{
+    Q_ASSERT(!isRecording());
+    const QString directory = QFileInfo(fileName).absolutePath();
+    if (!QDir().mkpath(directory)) {
+        *errorMessage = u"Unable to create directory \""_s
+                        + QDir::toNativeSeparators(directory) + u'"';
+        return false;
+    }
+    // Several generator processes of a parallel build may write concurrently
+    QSaveFile file(fileName);
+    if (!file.open(QIODevice::WriteOnly)) {
+        *errorMessage = u"Cannot open \""_s + QDir::toNativeSeparators(fileName)
+                        + u"\" for writing: "_s + file.errorString();
+        return false;
+    }
+    QDataStream str(&file);
+    str.setVersion(QDataStream::Qt_6_0);
+    str << snapshotMagic << snapshotVersion << m_typeSystemFile << m_conditions
+        << quint32(m_dependencies.size());
+    for (const auto &d : m_dependencies)
+        str << d.fileName << d.size << d.lastModified;
+    str << m_snippets << qCompress(m_xml);
+    if (str.status() != QDataStream::Ok || !file.commit()) {
+        *errorMessage = u"Failed to write \""_s + QDir::toNativeSeparators(fileName)
+                        + u"\": "_s + file.errorString();
+        return false;
+    }
+    return true;
+}
+
+std::unique_ptr<TypeSystemSnapshot>
+    TypeSystemSnapshot::load(const QString &fileName, const QString &typeSystemFile,
+                             const QStringList &conditions, QString *errorMessage)
+{
+    QFile file(fileName);
+    if (!file.exists())
+        return {};
+    if (!file.open(QIODevice::ReadOnly)) {
+        *errorMessage = msgCannotOpenForReading(file);
+        return {};
+    }
+    QDataStream str(&file);
+    str.setVersion(QDataStream::Qt_6_0);
+    quint32 magic{};
+    quint32 version{};
+    str >> magic >> version;
+    if (magic != snapshotMagic || version != snapshotVersion)
+        return {};
+
+    auto result = std::make_unique<TypeSystemSnapshot>(typeSystemFile, conditions);
+    QString storedFile;
+    QStringList storedConditions;
+    quint32 dependencyCount{};
+    str >> storedFile >> storedConditions >> dependencyCount;
+    if (str.status() != QDataStream::Ok || storedFile != typeSystemFile
+        || storedConditions != conditions) {
+        return {};
+    }
+    for (quint32 i = 0; i < dependencyCount; ++i) {
+        Dependency d;
+        str >> d.fileName >> d.size >> d.lastModified;
+        if (!isUpToDate(d))
+            return {};
+        result->m_dependencies.append(d);
+    }
+    QByteArray compressedXml;
+    str >> result->m_snippets >> compressedXml;
+    if (str.status() != QDataStream::Ok) {
+        *errorMessage = u"Corrupt typesystem snapshot \""_s
+                        + QDir::toNativeSeparators(fileName) + u'"';
+        return {};
+    }
+    result->m_xml = qUncompress(compressedXml);
+    return result;
+}
+
+QString TypeSystemSnapshot::fileNameFor(const QString &directory,
+                                        const QString &typeSystemFile,
+                                        const QStringList &conditions)
+{
+    QCryptographicHash hash(QCryptographicHash::Sha1);
+    hash.addData(typeSystemFile.toUtf8());
+    for (const auto &c : conditions)
+        hash.addData(QByteArray('\n' + c.toUtf8()));
+    return directory + u'/' + QFileInfo(typeSystemFile).completeBaseName()
+        + u'_' + QString::fromLatin1(hash.result().toHex().left(16)) + u".tss"_s;
+}
@@ -0,0 +1,82 @@
+// Copyright (C) 2023 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only WITH Qt-GPL-exception-1.0
+
+#ifndef TYPESYSTEMSNAPSHOT_H
+#define TYPESYSTEMSNAPSHOT_H
+
+#include <QtCore/QByteArray>
+#include <QtCore/QBuffer>
+#include <QtCore/QHash>
+#include <QtCore/QList>
+#include <QtCore/QStringList>
+
+#include <memory>
+#include <optional>
+
+class ConditionalStreamReader;
+
+QT_FORWARD_DECLARE_CLASS(QXmlStreamWriter)
+
+/// TypeSystemSnapshot is a compact binary snapshot of a typesystem file as
+/// seen by TypeSystemParser: the XML after conditional processing and entity
+/// resolution, laid out on the lines of the file, and the code snippets
+/// extracted from files. It is recorded while parsing a typesystem file and
+/// used instead of the file when the typesystem is loaded as a dependency of
+/// another module. The snapshot is invalidated when any of the files it was
+/// built from changes.
+class TypeSystemSnapshot
+{
+public:
+    Q_DISABLE_COPY_MOVE(TypeSystemSnapshot)
+
+    explicit TypeSystemSnapshot(const QString &typeSystemFile,
+                                const QStringList &conditions);
+    ~TypeSystemSnapshot();
+
+    bool isRecording() const { return bool(m_writer); }
+    void startRecording();
+    void recordToken(const ConditionalStreamReader &reader);
+    void addDependency(const QString &fileName);
+    void addSnippet(const QString &fileName, const QString &label,
+                    const QString &code);
+    void finishRecording();
+
+    const QString &typeSystemFile() const { return m_typeSystemFile; }
+    const QByteArray &xml() const { return m_xml; }
+    std::optional<QString> snippet(const QString &fileName,
+                                   const QString &label) const;
+
+    bool save(const QString &fileName, QString *errorMessage) const;
+    /// Load a snapshot, returns null if it does not exist or is outdated.
+    static std::unique_ptr<TypeSystemSnapshot>
+        load(const QString &fileName, const QString &typeSystemFile,
+             const QStringList &conditions, QString *errorMessage);
+
+    /// File name of the snapshot for a typesystem file in a directory
+    static QString fileNameFor(const QString &directory, const QString &typeSystemFile,
+                               const QStringList &conditions);
+
+private:
+    struct Dependency
+    {
+        QString fileName;
+        qint64 size = 0;
+        qint64 lastModified = 0;
+    };
+
+    static QString snippetKey(const QString &fileName, const QString &label);
+    static bool isUpToDate(const Dependency &d);
+    void padToLine(qint64 line);
+
+    QString m_typeSystemFile;
+    QStringList m_conditions;
+    QList<Dependency> m_dependencies;
+    QHash<QString, QString> m_snippets;
+    QByteArray m_xml;
+
+    QBuffer m_buffer; // Recording
+    std::unique_ptr<QXmlStreamWriter> m_writer;
+    qint64 m_line = 1; // Current line of the recorded XML
+};
+
+#endif // TYPESYSTEMSNAPSHOT_H
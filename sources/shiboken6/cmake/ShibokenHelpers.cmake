@@ -261,6 +261,22 @@ macro(shiboken_check_if_limited_api)
 
     message(STATUS "PYTHON_LIMITED_LIBRARIES: " ${PYTHON_LIMITED_LIBRARIES})
 
+    # The limited API is not supported by free-threaded (no-GIL) Python builds.
+    if(NOT SHIBOKEN_IS_CROSS_BUILD)
+        execute_process(
+            COMMAND ${PYTHON_EXECUTABLE} -c "if True:
+                import sysconfig
+                print(1 if sysconfig.get_config_var('Py_GIL_DISABLED') else 0)
+                "
+            OUTPUT_VARIABLE PYTHON_GIL_DISABLED
+            OUTPUT_STRIP_TRAILING_WHITESPACE)
+    endif()
+    if(PYTHON_GIL_DISABLED)
+        message(STATUS "Free-threaded Python detected, disabling the limited API.")
+        set(FORCE_LIMITED_API OFF)
+        set(SHIBOKEN_PYTHON_LIMITED_API 0)
+    endif()
+
     if(FORCE_LIMITED_API OR SHIBOKEN_PYTHON_LIMITED_API)
         set(PYTHON_LIMITED_API 1)
         if(WIN32)
@@ -18,19 +18,28 @@
 #include "namespacetypeentry.h"
 #include "primitivetypeentry.h"
 #include "typesystemtypeentry.h"
+#include <statistics.h>
 #include <typedatabase.h>
 
 #include "qtcompat.h"
 
 #include <QtCore/QDir>
+#include <QtCore/QElapsedTimer>
 #include <QtCore/QFile>
 #include <QtCore/QFileInfo>
 #include <QtCore/QRegularExpression>
+#include <QtCore/QThread>
+#include <QtCore/QThreadPool>
+
+#include <exception>
+#include <memory>
+#include <vector>
 
 using namespace Qt::StringLiterals;
 
 static const char ENABLE_PYSIDE_EXTENSIONS[] = "enable-pyside-extensions";
 static const char AVOID_PROTECTED_HACK[] = "avoid-protected-hack";
+static const char JOBS[] = "jobs";
 
 struct Generator::GeneratorPrivate
 {
@@ -39,9 +48,11 @@ struct Generator::GeneratorPrivate
     // License comment
     QString licenseComment;
     AbstractMetaClassCList m_invisibleTopNamespaces;
+    QList<Generator::GeneratedFile> m_generatedFiles;
     bool m_hasPrivateClasses = false;
     bool m_usePySideExtensions = false;
     bool m_avoidProtectedHack = false;
+    int m_jobs = 1;
 };
 
 Generator::Generator() : m_d(new GeneratorPrivate)
@@ -83,18 +94,28 @@ Generator::OptionDescriptions Generator::options() const
     return {
         {QLatin1StringView(AVOID_PROTECTED_HACK),
          u"Avoid the use of the '#define protected public' hack."_s},
+        {QLatin1StringView(JOBS) + u"=<number>"_s,
+         u"Number of threads generating the class files (0: number of CPUs)"_s},
         {QLatin1StringView(ENABLE_PYSIDE_EXTENSIONS),
          u"Enable PySide extensions, such as support for signal/slots,\n"
           "use this if you are creating a binding for a Qt-based library."_s}
     };
 }
 
-bool Generator::handleOption(const QString & key, const QString & /* value */)
+bool Generator::handleOption(const QString & key, const QString & value)
 {
     if (key == QLatin1StringView(ENABLE_PYSIDE_EXTENSIONS))
         return ( m_d->m_usePySideExtensions = true);
     if (key == QLatin1StringView(AVOID_PROTECTED_HACK))
         return (m_d->m_avoidProtectedHack = true);
+    if (key == QLatin1StringView(JOBS)) {
+        bool ok;
+        const int jobs = value.toInt(&ok);
+        if (!ok || jobs < 0)
+            return false;
+        m_d->m_jobs = jobs > 0 ? jobs : QThread::idealThreadCount();
+        return true;
+    }
     return false;
 }
 
@@ -174,29 +195,115 @@ void Generator::setOutputDirectory(const QString &outDir)
     m_d->outDir = outDir;
 }
 
-bool Generator::generateFileForContext(const GeneratorContext &context)
+// Returns the path of the file to be written for a context or an empty
+// string if nothing is to be generated.
+QString Generator::filePathForContext(const GeneratorContext &context) const
 {
-    const auto cls = context.metaClass();
-    auto typeEntry = cls->typeEntry();
-
+    const auto typeEntry = context.metaClass()->typeEntry();
     if (!shouldGenerate(typeEntry))
-        return true;
+        return {};
 
     const QString fileName = fileNameForContext(context);
     if (fileName.isEmpty())
-        return true;
+        return {};
 
-    QString filePath = outputDirectory() + u'/'
+    return outputDirectory() + u'/'
         + subDirectoryForPackage(typeEntry->targetLangPackage())
         + u'/' + fileName;
+}
+
+bool Generator::generateFileForContext(const GeneratorContext &context)
+{
+    const QString filePath = filePathForContext(context);
+    if (filePath.isEmpty())
+        return true;
+
+    const auto cls = context.metaClass();
     FileOut fileOut(filePath);
 
+    QElapsedTimer timer;
+    if (Statistics::isEnabled())
+        timer.start();
     generateClass(fileOut.stream, context);
+    if (timer.isValid()) {
+        Statistics::addClassTime(QLatin1StringView(name()), cls->qualifiedCppName(),
+                                 QFileInfo(filePath).fileName(), timer.nsecsElapsed());
+    }
+    m_d->m_generatedFiles.append({cls->typeEntry(), filePath, fileOut.size()});
 
     fileOut.done();
     return true;
 }
 
+// A file generated by a worker thread of generateFilesInParallel()
+struct ParallelFile
+{
+    GeneratorContext context;
+    QString filePath;
+    std::unique_ptr<FileOut> fileOut;
+    qint64 nsecs = 0;
+    qsizetype size = 0;
+    std::exception_ptr error;
+};
+
+// Generates the files on a thread pool. The results (statistics, list of
+// generated files, diff output) are collected in the order of the contexts
+// so that the output does not depend on the scheduling.
+bool Generator::generateFilesInParallel(const QList<GeneratorContext> &contexts)
+{
+    // Compute the lazily determined type indexes up front
+    getMaxTypeIndex();
+
+    std::vector<ParallelFile> files;
+    files.reserve(contexts.size());
+    for (const auto &context : contexts) {
+        QString filePath = filePathForContext(context);
+        if (!filePath.isEmpty())
+            files.push_back({context, filePath, {}, 0, 0, {}});
+    }
+
+    // In diff mode, done() prints, which is done sequentially afterwards
+    const bool diff = FileOut::diff();
+    QThreadPool pool;
+    pool.setMaxThreadCount(m_d->m_jobs);
+    for (auto &file : files) {
+        pool.start([this, &file, diff] {
+            try {
+                file.fileOut = std::make_unique<FileOut>(file.filePath);
+                QElapsedTimer timer;
+                timer.start();
+                generateClass(file.fileOut->stream, file.context);
+                file.nsecs = timer.nsecsElapsed();
+                file.size = file.fileOut->size();
+                if (!diff) {
+                    file.fileOut->done();
+                    file.fileOut.reset();
+                }
+            } catch (...) {
+                file.error = std::current_exception();
+            }
+        });
+    }
+    pool.waitForDone();
+
+    for (auto &file : files) {
+        if (file.error)
+            std::rethrow_exception(file.error);
+        const auto cls = file.context.metaClass();
+        Statistics::addClassTime(QLatin1StringView(name()), cls->qualifiedCppName(),
+                                 QFileInfo(file.filePath).fileName(), file.nsecs);
+        m_d->m_generatedFiles.append({cls->typeEntry(), file.filePath, file.size});
+        if (file.fileOut)
+            file.fileOut->done();
+    }
+    return true;
+}
+
+const QList<Generator::GeneratedFile> &Generator::generatedFiles() const
+{
+    return m_d->m_generatedFiles;
+}
+
 QString Generator::getFileNameBaseForSmartPointer(const AbstractMetaType &smartPointerType)
 {
     const AbstractMetaType innerType = smartPointerType.getSmartPointerInnerType();
@@ -231,9 +338,9 @@ GeneratorContext
 
 bool Generator::generate()
 {
+    QList<GeneratorContext> contexts;
     for (const auto &cls : m_d->api.classes()) {
-        if (!generateFileForContext(contextForClass(cls)))
-            return false;
+        contexts.append(contextForClass(cls));
         auto te = cls->typeEntry();
         if (shouldGenerate(te) && te->isPrivate())
             m_d->m_hasPrivateClasses = true;
@@ -243,10 +350,17 @@ bool Generator::generate()
         AbstractMetaClassCPtr pointeeClass;
         const auto instantiatedType = smp.type.instantiations().constFirst().typeEntry();
         if (instantiatedType->isComplex()) // not a C++ primitive
-            pointeeClass = AbstractMetaClass::findClass(m_d->api.classes(), instantiatedType);
-        if (!generateFileForContext(contextForSmartPointer(smp.specialized, smp.type,
-                                                           pointeeClass))) {
+            pointeeClass = m_d->api.findClass(instantiatedType);
+        contexts.append(contextForSmartPointer(smp.specialized, smp.type, pointeeClass));
+    }
+
+    if (m_d->m_jobs > 1 && supportsParallelGeneration()) {
+        if (!generateFilesInParallel(contexts))
             return false;
+    } else {
+        for (const auto &context : contexts) {
+            if (!generateFileForContext(context))
+                return false;
         }
     }
     return finishGeneration();
@@ -369,7 +483,7 @@ std::optional<DefaultValue>
         auto cType = std::static_pointer_cast<const ComplexTypeEntry>(type.typeEntry());
         if (cType->hasDefaultConstructor())
             return DefaultValue(DefaultValue::Custom, cType->defaultConstructor());
-        auto klass = AbstractMetaClass::findClass(api.classes(), cType);
+        auto klass = api.findClass(cType);
         if (!klass) {
             if (errorString != nullptr)
                 *errorString = msgClassNotFound(cType);
@@ -434,7 +548,7 @@ std::optional<DefaultValue>
         return DefaultValue(DefaultValue::DefaultConstructor, type->qualifiedCppName());
 
     if (type->isComplex()) {
-        auto klass = AbstractMetaClass::findClass(api.classes(), type);
+        auto klass = api.findClass(type);
         if (!klass) {
             if (errorString != nullptr)
                 *errorString = msgClassNotFound(type);
@@ -131,6 +131,22 @@ protected:
     /// Generates a file for given AbstractMetaClass or AbstractMetaType (smart pointer case).
     bool generateFileForContext(const GeneratorContext &context);
 
+    /// Returns whether generateClass() may be called from several threads
+    /// at once (option --jobs).
+    virtual bool supportsParallelGeneration() const { return false; }
+
+    /// A file written by generateFileForContext() with the size of its
+    /// contents, which serves as an estimate of its compilation cost.
+    struct GeneratedFile
+    {
+        ComplexTypeEntryCPtr typeEntry;
+        QString filePath;
+        qsizetype size = 0;
+    };
+
+    /// Returns the files written by generateFileForContext() in order.
+    const QList<GeneratedFile> &generatedFiles() const;
+
     /// Returns the file base name for a smart pointer.
     static QString getFileNameBaseForSmartPointer(const AbstractMetaType &smartPointerType);
 
@@ -213,6 +229,9 @@ protected:
     virtual QString subDirectoryForPackage(QString packageName = QString()) const;
 
 private:
+    QString filePathForContext(const GeneratorContext &context) const;
+    bool generateFilesInParallel(const QList<GeneratorContext> &contexts);
+
     struct GeneratorPrivate;
     GeneratorPrivate *m_d;
 };
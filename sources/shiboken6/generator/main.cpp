@@ -12,6 +12,7 @@
 #include <fileout.h>
 #include <messages.h>
 #include <reporthandler.h>
+#include <statistics.h>
 #include <typedatabase.h>
 
 #include <QtCore/QDir>
@@ -49,6 +50,9 @@ static inline QString diffOption() { return QStringLiteral("diff"); }
 static inline QString useGlobalHeaderOption() { return QStringLiteral("use-global-header"); }
 static inline QString dryrunOption() { return QStringLiteral("dry-run"); }
 static inline QString skipDeprecatedOption() { return QStringLiteral("skip-deprecated"); }
+static inline QString codeModelCacheOption() { return QStringLiteral("code-model-cache"); }
+static inline QString typesystemSnapshotsOption() { return QStringLiteral("typesystem-snapshots"); }
+static inline QString timingOption() { return QStringLiteral("timing"); }
 static inline QString printBuiltinTypesOption() { return QStringLiteral("print-builtin-types"); }
 
 static const char helpHint[] = "Note: use --help or -h for more information.\n";
@@ -364,6 +368,12 @@ void printUsage()
          u"generator-set to be used. e.g. qtdoc"_s},
         {skipDeprecatedOption(),
          u"Skip deprecated functions"_s},
+        {codeModelCacheOption() + u"=<directory>"_s,
+         u"Directory for caching the C++ code model parsed by clang"_s},
+        {typesystemSnapshotsOption() + u"=<directory>"_s,
+         u"Directory for snapshots of parsed typesystem files used by dependent modules"_s},
+        {timingOption() + u"=<file>"_s,
+         u"Write timing statistics of the phases and classes to a JSON file"_s},
         {diffOption(), u"Print a diff of wrapper files"_s},
         {dryrunOption(), u"Dry run, do not generate wrapper files"_s},
         {u"-h"_s, {} },
@@ -544,6 +554,26 @@ int shibokenMain(const QStringList &argV)
         args.options.erase(ait);
     }
 
+    ait = args.options.find(codeModelCacheOption());
+    if (ait != args.options.end()) {
+        extractor.setCodeModelCacheDirectory(ait.value().toString());
+        args.options.erase(ait);
+    }
+
+    ait = args.options.find(typesystemSnapshotsOption());
+    if (ait != args.options.end()) {
+        TypeDatabase::instance()->setSnapshotDirectory(ait.value().toString());
+        args.options.erase(ait);
+    }
+
+    QString timingFile;
+    ait = args.options.find(timingOption());
+    if (ait != args.options.end()) {
+        timingFile = ait.value().toString();
+        Statistics::setEnabled(true);
+        args.options.erase(ait);
+    }
+
     ait = args.options.find(u"silent"_s);
     if (ait != args.options.end()) {
         extractor.setSilent(true);
@@ -743,7 +773,9 @@ int shibokenMain(const QStringList &argV)
         g->setOutputDirectory(outputDirectory);
         g->setLicenseComment(licenseComment);
         ReportHandler::startProgress(QByteArray("Running ") + g->name() + "...");
+        Statistics::startPhase(u"Running "_s + QLatin1StringView(g->name()));
         const bool ok = g->setup(apiOpt.value()) && g->generate();
+        Statistics::endPhase();
         ReportHandler::endProgress();
          if (!ok) {
              errorPrint(u"Error running generator: "_s
@@ -752,6 +784,12 @@ int shibokenMain(const QStringList &argV)
          }
     }
 
+    if (!timingFile.isEmpty()) {
+        QString errorMessage;
+        if (!Statistics::write(timingFile, &errorMessage))
+            qCWarning(lcShiboken, "%s", qPrintable(errorMessage));
+    }
+
     const QByteArray doneMessage = ReportHandler::doneMessage();
     std::cout << doneMessage.constData() << std::endl;
 
@@ -723,7 +723,7 @@ QString QtDocGenerator::translateToPythonType(const AbstractMetaType &type,
                                          .arg(types[0], types[1]);
         }
     } else {
-        auto k = AbstractMetaClass::findClass(api().classes(), type.typeEntry());
+        auto k = api().findClass(type.typeEntry());
         strType = k ? k->fullName() : type.name();
         if (createRef) {
             strType.prepend(u":any:`"_s);
@@ -319,13 +319,19 @@ std::optional<AbstractMetaType>
     return {};
 }
 
-void CppGenerator::clearTpFuncs()
+using TpFunctions = QHash<QString, QString>;
+
+// Functions written as type slots (tp_repr, etc) instead of PyMethodDef entries
+static TpFunctions initialTpFunctions()
 {
-    m_tpFuncs = {
-        {u"__str__"_s, {}}, {u"__str__"_s, {}},
-        {reprFunction(), {}}, {u"__iter__"_s, {}},
-        {u"__next__"_s, {}}
-    };
+    return {{u"__str__"_s, {}}, {reprFunction(), {}},
+            {u"__iter__"_s, {}}, {u"__next__"_s, {}}};
+}
+
+static bool isTpFunction(const QString &name)
+{
+    static const TpFunctions tpFunctions = initialTpFunctions();
+    return tpFunctions.contains(name);
 }
 
 // Prevent ELF symbol qt_version_tag from being generated into the source
@@ -514,6 +520,8 @@ void CppGenerator::generateIncludes(TextStream &s, const GeneratorContext &class
     // headers
     s << "// default includes\n";
     s << "#include <shiboken.h>\n";
+    if (callProfiling())
+        s << "#include <sbkcallprofiler.h>\n";
     if (wrapperDiagnostics()) {
         s << "#include <helper.h>\n";
         cppIncludes << "iostream";
@@ -621,6 +629,17 @@ static void writeAddedTypeSignatures(TextStream &s, const ComplexTypeEntryCPtr &
     }
 }
 
+QString CppGenerator::usingNamespace(const AbstractMetaClassCPtr &metaClass)
+{
+    for (auto context = metaClass->enclosingClass(); context; context = context->enclosingClass()) {
+        if (context->isNamespace() && !context->enclosingClass()
+            && std::static_pointer_cast<const NamespaceTypeEntry>(context->typeEntry())->generateUsing()) {
+            return context->qualifiedCppName();
+        }
+    }
+    return {};
+}
+
 /// Function used to write the class generated binding code on the buffer
 /// \param s the output buffer
 /// \param classContext the pointer to metaclass information
@@ -656,17 +675,9 @@ void CppGenerator::generateClass(TextStream &s, const GeneratorContext &classCon
         s << "#Deprecated\n";
 
     // Use class base namespace
-    {
-        AbstractMetaClassCPtr context = metaClass->enclosingClass();
-        while (context) {
-            if (context->isNamespace() && !context->enclosingClass()
-                && std::static_pointer_cast<const NamespaceTypeEntry>(context->typeEntry())->generateUsing()) {
-                s << "\nusing namespace " << context->qualifiedCppName() << ";\n";
-                break;
-            }
-            context = context->enclosingClass();
-        }
-    }
+    const QString namespaceUsed = usingNamespace(metaClass);
+    if (!namespaceUsed.isEmpty())
+        s << "\nusing namespace " << namespaceUsed << ";\n";
 
     s  << '\n';
 
@@ -753,7 +764,7 @@ void CppGenerator::generateClass(TextStream &s, const GeneratorContext &classCon
                 smd << "static PyMethodDef " << methDefName << " = " << indent
                     << defEntries.constFirst() << outdent << ";\n\n";
             }
-            if (!m_tpFuncs.contains(rfunc->name()))
+            if (!isTpFunction(rfunc->name()))
                 md << defEntries;
         }
     }
@@ -2206,7 +2217,7 @@ static AbstractMetaClassCList findSmartPointeeBaseClasses(const ApiExtractorResu
 {
     AbstractMetaClassCList result;
     auto instantiationsTe = smartPointerType.instantiations().at(0).typeEntry();
-    auto targetClass = AbstractMetaClass::findClass(api.classes(), instantiationsTe);
+    auto targetClass = api.findClass(instantiationsTe);
     if (targetClass != nullptr)
         result = targetClass->allTypeSystemAncestors();
     return result;
@@ -3909,7 +3920,7 @@ CppGenerator::argumentClassFromIndex(const ApiExtractorResult &api,
     auto te = type.typeEntry();
     if (type.isVoid() || !te->isComplex())
         throw Exception(msgInvalidArgumentModification(func, argIndex));
-    const auto result = AbstractMetaClass::findClass(api.classes(), te);
+    const auto result = api.findClass(te);
     if (!result)
         throw Exception(msgClassNotFound(te));
     return result;
@@ -3940,6 +3951,19 @@ static QString explicitConversion(QString v, const AbstractMetaType &t)
     return t.plainType().cppSignature() + u'(' + v + u')';
 }
 
+// Instantiate the statistics entry of the function and start measuring
+// (--call-profiling).
+void CppGenerator::writeCallProfilerScope(TextStream &s, const AbstractMetaFunctionCPtr &func,
+                                          bool allowThread)
+{
+    const auto owner = func->ownerClass();
+    const QString className = owner ? owner->qualifiedCppName() : QString{};
+    s << "static Shiboken::CallProfiler::Entry callProfilerEntry(\""
+        << className << "\", \"" << func->minimalSignature() << "\", "
+        << (allowThread ? "true" : "false") << ");\n"
+        << "Shiboken::CallProfiler::Scope callProfiler(&callProfilerEntry);\n";
+}
+
 void CppGenerator::writeMethodCall(TextStream &s, const AbstractMetaFunctionCPtr &func,
                                    const GeneratorContext &context, bool usesPyArgs,
                                    int maxArgs,
@@ -4199,6 +4223,8 @@ void CppGenerator::writeMethodCall(TextStream &s, const AbstractMetaFunctionCPtr
 
         if (!injectedCodeCallsCppFunction(context, func)) {
             const bool allowThread = func->allowThread();
+            if (callProfiling())
+                writeCallProfilerScope(s, func, allowThread);
             generateExceptionHandling = func->generateExceptionHandling();
             if (generateExceptionHandling) {
                 s << tryBlock << indent;
@@ -4209,6 +4235,8 @@ void CppGenerator::writeMethodCall(TextStream &s, const AbstractMetaFunctionCPtr
             } else if (allowThread) {
                 s << BEGIN_ALLOW_THREADS << '\n';
             }
+            if (callProfiling())
+                s << "callProfiler.callStarted();\n";
             if (isCtor) {
                 if (uva.size() > 0)
                     s << uva.toString() << '\n';
@@ -4249,10 +4277,14 @@ void CppGenerator::writeMethodCall(TextStream &s, const AbstractMetaFunctionCPtr
                 s << mc.toString() << ";\n";
             }
 
+            if (callProfiling())
+                s << "callProfiler.callFinished();\n";
             if (allowThread) {
                 s << (generateExceptionHandling
                       ? u"threadSaver.restore();"_s : END_ALLOW_THREADS) << '\n';
             }
+            if (callProfiling())
+                s << "callProfiler.finish();\n";
 
             // Convert result
             const auto funcType = func->type();
@@ -4803,14 +4835,14 @@ void CppGenerator::writeClassDefinition(TextStream &s,
         tp_getset = cpythonGettersSettersDefinitionName(metaClass);
 
     // search for special functions
-    clearTpFuncs();
+    TpFunctions tpFuncs = initialTpFunctions();
     for (const auto &func : metaClass->functions()) {
-        if (m_tpFuncs.contains(func->name()))
-            m_tpFuncs[func->name()] = cpythonFunctionName(func);
+        if (tpFuncs.contains(func->name()))
+            tpFuncs[func->name()] = cpythonFunctionName(func);
     }
-    if (m_tpFuncs.value(reprFunction()).isEmpty()
+    if (tpFuncs.value(reprFunction()).isEmpty()
         && metaClass->hasToStringCapability()) {
-        m_tpFuncs[reprFunction()] = writeReprFunction(s,
+        tpFuncs[reprFunction()] = writeReprFunction(s,
                 classContext,
                 metaClass->toStringCapabilityIndirections());
     }
@@ -4842,17 +4874,17 @@ void CppGenerator::writeClassDefinition(TextStream &s,
         << "}\n\nstatic PyType_Slot " << className << "_slots[] = {\n" << indent
         << "{Py_tp_base,        nullptr}, // inserted by introduceWrapperType\n"
         << pyTypeSlotEntry("Py_tp_dealloc", tp_dealloc)
-        << pyTypeSlotEntry("Py_tp_repr", m_tpFuncs.value(reprFunction()))
+        << pyTypeSlotEntry("Py_tp_repr", tpFuncs.value(reprFunction()))
         << pyTypeSlotEntry("Py_tp_hash", tp_hash)
         << pyTypeSlotEntry("Py_tp_call", tp_call)
-        << pyTypeSlotEntry("Py_tp_str", m_tpFuncs.value(u"__str__"_s))
+        << pyTypeSlotEntry("Py_tp_str", tpFuncs.value(u"__str__"_s))
         << pyTypeSlotEntry("Py_tp_getattro", tp_getattro)
         << pyTypeSlotEntry("Py_tp_setattro", tp_setattro)
         << pyTypeSlotEntry("Py_tp_traverse", className + u"_traverse"_s)
         << pyTypeSlotEntry("Py_tp_clear", className + u"_clear"_s)
         << pyTypeSlotEntry("Py_tp_richcompare", tp_richcompare)
-        << pyTypeSlotEntry("Py_tp_iter", m_tpFuncs.value(u"__iter__"_s))
-        << pyTypeSlotEntry("Py_tp_iternext", m_tpFuncs.value(u"__next__"_s))
+        << pyTypeSlotEntry("Py_tp_iter", tpFuncs.value(u"__iter__"_s))
+        << pyTypeSlotEntry("Py_tp_iternext", tpFuncs.value(u"__next__"_s))
         << pyTypeSlotEntry("Py_tp_methods", className + u"_methods"_s)
         << pyTypeSlotEntry("Py_tp_getset", tp_getset)
         << pyTypeSlotEntry("Py_tp_init", tp_init)
@@ -5988,23 +6020,244 @@ QString CppGenerator::getInitFunctionName(const GeneratorContext &context)
     return getSimpleClassInitFunctionName(context.metaClass());
 }
 
-void CppGenerator::writeSignatureStrings(TextStream &s,
-                                         const QString &signatures,
-                                         const QString &arrayName,
-                                         const char *comment)
+// PYSIDE-510: The signatures of the introspection feature are written as
+// tables of the split text lines "[n:]Module.Class.function(self,a:int=0)->int"
+// so that libshiboken does not need to parse them at runtime.
+struct SignatureLine
+{
+    int multi = -1;
+    QString text; // without the "n:" prefix
+};
+
+struct SignatureParameter
+{
+    QString name;
+    QString annotation;
+    QString defaultValue;
+    bool hasDefault = false;
+};
+
+struct SignatureEntry
+{
+    int multi = -1;
+    QString funcName;
+    QList<SignatureParameter> parameters;
+    QString returnType;
+};
+
+// Corresponds to `fixup_multilines()` of `parser.py`: The overloads can
+// collapse when distinctions between C++ types vanish in Python. Sort them,
+// remove the duplicates and renumber them.
+static void fixupMultiLines(QList<SignatureLine> *lines)
+{
+    const auto byText = [](const SignatureLine &l1, const SignatureLine &l2) {
+        return l1.text < l2.text;
+    };
+    const auto sameText = [](const SignatureLine &l1, const SignatureLine &l2) {
+        return l1.text == l2.text;
+    };
+    for (qsizetype i = 0; i < lines->size(); ) {
+        if (lines->at(i).multi < 0) {
+            ++i;
+            continue;
+        }
+        qsizetype end = i;
+        while (end < lines->size() && lines->at(end).multi != 0)
+            ++end;
+        if (end < lines->size())
+            ++end;
+        const auto first = lines->begin() + i;
+        const auto last = lines->begin() + end;
+        std::sort(first, last, byText);
+        const auto newLast = std::unique(first, last, sameText);
+        const qsizetype count = newLast - first;
+        lines->erase(newLast, last);
+        for (qsizetype j = 0; j < count; ++j)
+            (*lines)[i + j].multi = count > 1 ? int(count - j - 1) : -1;
+        i += count;
+    }
+}
+
+// Find a character outside of brackets and quotes.
+static qsizetype findTopLevel(QStringView s, QChar c)
+{
+    int depth = 0;
+    QChar quote;
+    for (qsizetype i = 0, size = s.size(); i < size; ++i) {
+        const QChar ch = s.at(i);
+        if (!quote.isNull()) {
+            if (ch == quote)
+                quote = QChar();
+            continue;
+        }
+        switch (ch.unicode()) {
+        case u'\'':
+        case u'"':
+            quote = ch;
+            break;
+        case u'(':
+        case u'[':
+        case u'{':
+            ++depth;
+            break;
+        case u')':
+        case u']':
+        case u'}':
+            if (depth == 0 && ch == c)
+                return i;
+            --depth;
+            break;
+        default:
+            if (ch == c && depth == 0)
+                return i;
+            break;
+        }
+    }
+    return -1;
+}
+
+// Split a signature line following the rules of `_parse_line()` of `parser.py`.
+static bool parseSignatureLine(const SignatureLine &line, SignatureEntry *entry)
+{
+    const QStringView text = QStringView{line.text}.trimmed();
+    const auto open = text.indexOf(u'(');
+    if (open <= 0)
+        return false;
+    entry->multi = line.multi;
+    entry->funcName = text.left(open).toString();
+    auto rest = text.mid(open + 1);
+    const auto close = findTopLevel(rest, u')');
+    if (close < 0)
+        return false;
+    const auto returnPart = rest.mid(close + 1);
+    if (!returnPart.isEmpty()) {
+        if (!returnPart.startsWith(u"->"))
+            return false;
+        entry->returnType = returnPart.mid(2).toString();
+    }
+    rest.truncate(close);
+    for (qsizetype idx = 0; !rest.isEmpty(); ++idx) {
+        const auto pos = findTopLevel(rest, u',');
+        const auto argument = (pos < 0 ? rest : rest.left(pos)).trimmed();
+        rest = pos < 0 ? QStringView{} : rest.mid(pos + 1);
+        if (argument.isEmpty())
+            continue;
+        SignatureParameter parameter;
+        const auto typePos = argument.indexOf(u':');
+        if (typePos < 0) {
+            if (idx != 0 || (argument != u"self" && argument != u"cls"))
+                return false;
+            parameter.name = parameter.annotation = argument.toString();
+            entry->parameters.append(parameter);
+            continue;
+        }
+        parameter.name = argument.left(typePos).toString();
+        auto annotation = argument.mid(typePos + 1);
+        if (annotation.contains(u':'))
+            return false;
+        const auto defaultPos = annotation.indexOf(u'=');
+        if (defaultPos >= 0) {
+            parameter.defaultValue = annotation.mid(defaultPos + 1).toString();
+            parameter.hasDefault = true;
+            annotation.truncate(defaultPos);
+        }
+        parameter.annotation = annotation.toString();
+        entry->parameters.append(parameter);
+    }
+    return true;
+}
+
+static void writeSignatureLiteral(TextStream &s, QStringView value)
 {
-    s << "// The signatures string for the " << comment << ".\n"
-        << "// Multiple signatures have their index \"n:\" in front.\n"
-        << "static const char *" << arrayName << "_SignatureStrings[] = {\n" << indent;
-    const auto lines = QStringView{signatures}.split(u'\n', Qt::SkipEmptyParts);
-    for (auto line : lines) {
-        // must anything be escaped?
-        if (line.contains(u'"') || line.contains(u'\\'))
-            s << "R\"CPP(" << line << ")CPP\",\n";
+    // must anything be escaped?
+    if (value.contains(u'"') || value.contains(u'\\'))
+        s << "R\"CPP(" << value << ")CPP\"";
+    else
+        s << '"' << value << '"';
+}
+
+void CppGenerator::writeSignatureTable(TextStream &s,
+                                       const QString &signatures,
+                                       const QString &arrayName,
+                                       const char *comment)
+{
+    QList<SignatureLine> lines;
+    const auto textLines = QStringView{signatures}.split(u'\n', Qt::SkipEmptyParts);
+    for (auto textLine : textLines) {
+        SignatureLine line;
+        const auto open = textLine.indexOf(u'(');
+        const auto colon = textLine.indexOf(u':');
+        bool ok = false;
+        if (colon > 0 && colon < open) {
+            const int multi = textLine.left(colon).toInt(&ok);
+            if (ok && multi >= 0)
+                line.multi = multi;
+        }
+        line.text = (line.multi >= 0 ? textLine.mid(colon + 1) : textLine).toString();
+        lines.append(line);
+    }
+    fixupMultiLines(&lines);
+
+    QList<SignatureEntry> entries;
+    for (const auto &line : std::as_const(lines)) {
+        SignatureEntry entry;
+        if (parseSignatureLine(line, &entry)) {
+            entries.append(entry);
+        } else {
+            qCWarning(lcShiboken).noquote().nospace()
+                << "Unable to parse the signature \"" << line.text << "\" of the "
+                << comment << " of " << arrayName << ", it will be omitted.";
+        }
+    }
+
+    const QString parametersArray = arrayName + u"_SignatureParameters"_s;
+    const bool hasParameters =
+        std::any_of(entries.cbegin(), entries.cend(),
+                    [](const SignatureEntry &e) { return !e.parameters.isEmpty(); });
+    if (hasParameters) {
+        s << "// The signature parameters (name, annotation, default) for the "
+            << comment << ".\n"
+            << "static const SbkSignatureParameter " << parametersArray << "[] = {\n"
+            << indent;
+        for (const auto &entry : std::as_const(entries)) {
+            for (const auto &parameter : entry.parameters) {
+                s << '{';
+                writeSignatureLiteral(s, parameter.name);
+                s << ", ";
+                writeSignatureLiteral(s, parameter.annotation);
+                s << ", ";
+                if (parameter.hasDefault)
+                    writeSignatureLiteral(s, parameter.defaultValue);
+                else
+                    s << NULL_PTR;
+                s << "},\n";
+            }
+        }
+        s << outdent << "};\n\n";
+    }
+
+    s << "// The signatures for the " << comment << ".\n"
+        << "// Multiple signatures have their index counting down to 0 in front.\n"
+        << "static const SbkSignature " << arrayName << "_Signatures[] = {\n" << indent;
+    qsizetype offset = 0;
+    for (const auto &entry : std::as_const(entries)) {
+        s << '{' << entry.multi << ", ";
+        writeSignatureLiteral(s, entry.funcName);
+        s << ", ";
+        if (entry.parameters.isEmpty())
+            s << NULL_PTR;
+        else
+            s << parametersArray << " + " << offset;
+        s << ", " << entry.parameters.size() << ", ";
+        if (entry.returnType.isEmpty())
+            s << NULL_PTR;
         else
-            s << '"' << line << "\",\n";
+            writeSignatureLiteral(s, entry.returnType);
+        s << "},\n";
+        offset += entry.parameters.size();
     }
-    s << NULL_PTR << "}; // Sentinel\n" << outdent << '\n';
+    s << "{-1, " << NULL_PTR << ", " << NULL_PTR << ", 0, " << NULL_PTR
+        << "} // Sentinel\n" << outdent << "};\n\n";
 }
 
 // Return the class name for which to invoke the destructor
@@ -6040,7 +6293,7 @@ void CppGenerator::writeClassRegister(TextStream &s,
     QString initFunctionName = getInitFunctionName(classContext);
 
     // PYSIDE-510: Create a signatures string for the introspection feature.
-    writeSignatureStrings(s, signatures, initFunctionName, "functions");
+    writeSignatureTable(s, signatures, initFunctionName, "functions");
     s << "void init_" << initFunctionName;
     s << "(PyObject *" << enclosingObjectVariable << ")\n{\n" << indent;
 
@@ -6126,7 +6379,7 @@ void CppGenerator::writeClassRegister(TextStream &s,
 
     s << outdent << ");\nauto *pyType = " << pyTypeName << "; // references "
         << typePtr << "\n"
-        << "InitSignatureStrings(pyType, " << initFunctionName << "_SignatureStrings);\n";
+        << "InitSignatureTable(pyType, " << initFunctionName << "_Signatures);\n";
 
     if (usePySideExtensions() && !classContext.forSmartPointer())
         s << "SbkObjectType_SetPropertyStrings(pyType, "
@@ -6463,14 +6716,13 @@ void CppGenerator::writeGetattroDefinition(TextStream &s, const AbstractMetaClas
 
 QString CppGenerator::qObjectGetAttroFunction() const
 {
-    static QString result;
-    if (result.isEmpty()) {
-        auto qobjectClass = AbstractMetaClass::findClass(api().classes(), qObjectT());
+    static const QString result = [this] {
+        auto qobjectClass = api().findClass(qObjectT());
         Q_ASSERT(qobjectClass);
-        result = u"PySide::getHiddenDataFromQObject("_s
-                 + cpythonWrapperCPtr(qobjectClass, u"self"_s)
-                 + u", self, name)"_s;
-    }
+        return u"PySide::getHiddenDataFromQObject("_s
+               + cpythonWrapperCPtr(qobjectClass, u"self"_s)
+               + u", self, name)"_s;
+    }();
     return result;
 }
 
@@ -6743,6 +6995,8 @@ bool CppGenerator::finishGeneration()
 
     if (!api().instantiatedContainers().isEmpty())
         s << "#include <sbkcontainer.h>\n#include <sbkstaticstrings.h>\n";
+    if (callProfiling())
+        s << "#include <sbkcallprofiler.h>\n";
 
     if (usePySideExtensions()) {
         s << includeQDebug;
@@ -6903,27 +7157,30 @@ bool CppGenerator::finishGeneration()
         s << '\n';
     }
 
-    s << "static struct PyModuleDef moduledef = {\n"
-        << "    /* m_base     */ PyModuleDef_HEAD_INIT,\n"
-        << "    /* m_name     */ \"" << moduleName() << "\",\n"
-        << "    /* m_doc      */ nullptr,\n"
-        << "    /* m_size     */ -1,\n"
-        << "    /* m_methods  */ " << moduleName() << "_methods,\n"
-        << "    /* m_reload   */ nullptr,\n"
-        << "    /* m_traverse */ nullptr,\n"
-        << "    /* m_clear    */ nullptr,\n"
-        << "    /* m_free     */ nullptr\n};\n\n";
+    const int maxTypeIndex = getMaxTypeIndex() + api().instantiatedSmartPointers().size();
+
+    // The arrays are referenced by the global variables of the module, so
+    // the module object is kept alive. They do not own references.
+    s << "// Module state holding the arrays of wrapper types and converters.\n"
+        << "struct ModuleState\n{\n" << indent;
+    if (maxTypeIndex)
+        s << "PyTypeObject *types[SBK_" << moduleName() << "_IDX_COUNT];\n";
+    s << "SbkConverter *converters[SBK_" << moduleName() << "_CONVERTERS_IDX_COUNT];\n"
+        << outdent << "};\n\n";
 
     // PYSIDE-510: Create a signatures string for the introspection feature.
-    writeSignatureStrings(s, signatureStream.toString(), moduleName(), "global functions");
+    writeSignatureTable(s, signatureStream.toString(), moduleName(), "global functions");
 
-    // Write module init function
+    // Write module exec function (multi-phase initialization)
     const QString globalModuleVar = pythonModuleObjectName();
-    s << "extern \"C\" LIBSHIBOKEN_EXPORT PyObject *PyInit_"
-        << moduleName() << "()\n{\n" << indent;
-    // Guard against repeated invocation
+    const QString execFunction = moduleName() + u"_exec"_s;
+    s << "static int " << execFunction << "(PyObject *module)\n{\n" << indent;
+    // The types can only be created once; further module objects (re-import
+    // after removal from sys.modules, legacy subinterpreters) share them.
     s << "if (" << globalModuleVar << " != nullptr)\n"
-        << indent << "return " << globalModuleVar << ";\n" << outdent;
+        << indent << "return Shiboken::Module::initDuplicate(module, "
+        << globalModuleVar << ");\n" << outdent << '\n'
+        << "Shiboken::init();\n\n";
 
     // module inject-code target/beginning
     if (!snips.isEmpty())
@@ -6933,7 +7190,7 @@ bool CppGenerator::finishGeneration()
         s << "{\n" << indent
              << "Shiboken::AutoDecRef requiredModule(Shiboken::Module::import(\"" << requiredModule << "\"));\n"
              << "if (requiredModule.isNull())\n" << indent
-             << "return nullptr;\n" << outdent
+             << "return -1;\n" << outdent
              << cppApiVariableName(requiredModule)
              << " = Shiboken::Module::getTypes(requiredModule);\n"
              << convertersVariableName(requiredModule)
@@ -6941,20 +7198,14 @@ bool CppGenerator::finishGeneration()
              << "}\n\n";
     }
 
-    int maxTypeIndex = getMaxTypeIndex() + api().instantiatedSmartPointers().size();
-    if (maxTypeIndex) {
-        s << "// Create an array of wrapper types for the current module.\n"
-           << "static PyTypeObject *cppApi[SBK_" << moduleName() << "_IDX_COUNT];\n"
-           << cppApiVariableName() << " = cppApi;\n\n";
-    }
-
-    s << "// Create an array of primitive type converters for the current module.\n"
-        << "static SbkConverter *sbkConverters[SBK_" << moduleName()
-        << "_CONVERTERS_IDX_COUNT" << "];\n"
-        << convertersVariableName() << " = sbkConverters;\n\n"
-        << "PyObject *module = Shiboken::Module::create(\""  << moduleName()
-        << "\", &moduledef);\n\n"
+    s << "// The arrays of wrapper types and primitive type converters of the\n"
+        << "// current module are stored in the module state.\n"
+        << "auto *state = reinterpret_cast<ModuleState *>(PyModule_GetState(module));\n";
+    if (maxTypeIndex)
+        s << cppApiVariableName() << " = state->types;\n";
+    s << convertersVariableName() << " = state->converters;\n\n"
         << "// Make module available from global scope\n"
+        << "Py_INCREF(module);\n"
         << globalModuleVar << " = module;\n\n"
         << "// Initialize classes in the type system\n"
         << s_classPythonDefines.toString();
@@ -7005,7 +7256,7 @@ bool CppGenerator::finishGeneration()
         }
     }
 
-    writeEnumsInitialization(s, globalEnums, ErrorReturn::Default);
+    writeEnumsInitialization(s, globalEnums, ErrorReturn::MinusOne);
 
     s << "// Register primitive types converters.\n";
     const PrimitiveTypeEntryCList &primitiveTypeList = primitiveTypes();
@@ -7066,11 +7317,45 @@ bool CppGenerator::finishGeneration()
     }
 
     // finish the rest of get_signature() initialization.
-    s << "FinishSignatureInitialization(module, " << moduleName()
-        << "_SignatureStrings);\n"
-        << "\nreturn module;\n" << outdent << "}\n";
+    s << "FinishSignatureTableInitialization(module, " << moduleName()
+        << "_Signatures);\n"
+        << "\nreturn 0;\n" << outdent << "}\n\n";
+
+    s << "static PyModuleDef_Slot " << moduleName() << "_slots[] = {\n" << indent
+        << "{Py_mod_exec, reinterpret_cast<void *>(" << execFunction << ")},\n"
+        << "#ifdef Py_mod_multiple_interpreters\n"
+        << "// The types are shared by all interpreters, which requires a shared GIL.\n"
+        << "{Py_mod_multiple_interpreters, Py_MOD_MULTIPLE_INTERPRETERS_SUPPORTED},\n"
+        << "#endif\n";
+    // Without the declaration, free-threaded Python re-enables the GIL
+    // when importing the module (--free-threading).
+    if (freeThreading()) {
+        s << "#ifdef Py_GIL_DISABLED\n"
+            << "{Py_mod_gil, Py_MOD_GIL_NOT_USED},\n"
+            << "#endif\n";
+    }
+    s << "{0, " << NULL_PTR << "}\n" << outdent << "};\n\n";
+
+    s << "static struct PyModuleDef moduledef = {\n"
+        << "    /* m_base     */ PyModuleDef_HEAD_INIT,\n"
+        << "    /* m_name     */ \"" << moduleName() << "\",\n"
+        << "    /* m_doc      */ nullptr,\n"
+        << "    /* m_size     */ sizeof(ModuleState),\n"
+        << "    /* m_methods  */ " << moduleName() << "_methods,\n"
+        << "    /* m_slots    */ " << moduleName() << "_slots,\n"
+        << "    /* m_traverse */ nullptr,\n"
+        << "    /* m_clear    */ nullptr,\n"
+        << "    /* m_free     */ nullptr\n};\n\n";
+
+    // Write module init function
+    s << "extern \"C\" LIBSHIBOKEN_EXPORT PyObject *PyInit_"
+        << moduleName() << "()\n{\n" << indent
+        << "return PyModuleDef_Init(&moduledef);\n" << outdent << "}\n";
 
     file.done();
+
+    if (unityBatches() > 0)
+        writeUnityBatches();
     return true;
 }
 
@@ -7100,7 +7385,7 @@ static bool useParentHeuristics(const ApiExtractorResult &api,
     auto argTypeEntry = argType.typeEntry();
     if (!argTypeEntry->isComplex())
         return false;
-    const auto argClass = AbstractMetaClass::findClass(api.classes(), argTypeEntry);
+    const auto argClass = api.findClass(argTypeEntry);
     return argClass && parentManagementEntry(argClass) == ownerEntry;
 }
 
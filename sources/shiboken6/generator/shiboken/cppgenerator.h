@@ -63,6 +63,10 @@ private:
     void generateIncludes(TextStream &s, const GeneratorContext &classContext,
                           const IncludeGroupList &includes = {},
                           const AbstractMetaClassCList &innerClasses = {}) const;
+    void writeUnityBatches() const;
+    /// Returns the namespace of the "using namespace" directive written into
+    /// the wrapper of a class, if any.
+    static QString usingNamespace(const AbstractMetaClassCPtr &metaClass);
     static void writeInitFunc(TextStream &declStr, TextStream &callStr,
                               const QString &initFunctionName,
                               const TypeEntryCPtr &enclosingEntry = {});
@@ -372,6 +376,8 @@ private:
         argumentClassFromIndex(const ApiExtractorResult &api,
                                const AbstractMetaFunctionCPtr &func, int argIndex);
 
+    static void writeCallProfilerScope(TextStream &s, const AbstractMetaFunctionCPtr &func,
+                                       bool allowThread);
     void writeMethodCall(TextStream &s, const AbstractMetaFunctionCPtr &func,
                          const GeneratorContext &context, bool usesPyArgs,
                          int maxArgs, const QList<qsizetype> &argumentIndirections,
@@ -382,9 +388,9 @@ private:
     static QString
         getSimpleClassStaticFieldsInitFunctionName(const AbstractMetaClassCPtr &metaClass);
 
-    static void writeSignatureStrings(TextStream &s, const QString &signatures,
-                                      const QString &arrayName,
-                                      const char *comment);
+    static void writeSignatureTable(TextStream &s, const QString &signatures,
+                                    const QString &arrayName,
+                                    const char *comment);
     void writeClassRegister(TextStream &s,
                             const AbstractMetaClassCPtr &metaClass,
                             const GeneratorContext &classContext,
@@ -540,10 +546,6 @@ private:
     std::optional<AbstractMetaType>
         findSmartPointerInstantiation(const SmartPointerTypeEntryCPtr &pointer,
                                       const TypeEntryCPtr &pointee) const;
-    void clearTpFuncs();
-
-    QHash<QString, QString> m_tpFuncs;
-
     static const char *PYTHON_TO_CPPCONVERSION_STRUCT;
 };
 
@@ -0,0 +1,83 @@
+// Copyright (C) 2023 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only WITH Qt-GPL-exception-1.0
+
+#include "cppgenerator.h"
+#include "unitybatches.h"
+#include "abstractmetalang.h"
+#include "apiextractorresult.h"
+#include "codesnip.h"
+#include "complextypeentry.h"
+#include "fileout.h"
+#include "reporthandler.h"
+#include "textstream.h"
+
+#include <QtCore/QDir>
+#include <QtCore/QFileInfo>
+#include <QtCore/QSet>
+
+using namespace Qt::StringLiterals;
+
+// The native code snippets injected into a class (see distributeBatches())
+static QSet<QString> nativeCodeSnippets(const ComplexTypeEntryCPtr &typeEntry)
+{
+    QSet<QString> result;
+    for (const auto &snip : typeEntry->codeSnips()) {
+        if (snip.language == TypeSystem::NativeCode) {
+            const QString code = snip.code().trimmed();
+            if (!code.isEmpty())
+                result.insert(code);
+        }
+    }
+    return result;
+}
+
+// Write the batch source files "<module>_batch_<n>.cpp" including the
+// wrapper files of the classes. The number of files is always the requested
+// number, so that build systems can list them in advance; surplus batches
+// are empty. The module wrapper is not included since its file-static
+// helpers use generic names.
+void CppGenerator::writeUnityBatches() const
+{
+    const QString directory = outputDirectory() + u'/' + subDirectoryForPackage(packageName());
+    const QString baseName = moduleName().toLower() + u"_batch_"_s;
+    const auto &files = generatedFiles();
+    QList<UnityBatchFile> batchFiles;
+    batchFiles.reserve(files.size());
+    for (const auto &file : files) {
+        // Smart pointer wrappers do not use namespaces (see generateClass())
+        const auto metaClass = file.typeEntry->isSmartPointer()
+            ? AbstractMetaClassCPtr{} : api().findClass(file.typeEntry);
+        batchFiles.append({file.size,
+                           metaClass ? usingNamespace(metaClass) : QString{},
+                           nativeCodeSnippets(file.typeEntry)});
+    }
+    const int batchCount = unityBatches();
+    QList<qsizetype> conflicts;
+    const QList<UnityBatch> batches = distributeBatches(batchFiles, batchCount, &conflicts);
+    for (auto index : std::as_const(conflicts)) {
+        qCWarning(lcShiboken, "%s: The wrapper of %s uses native code or a namespace "
+                  "conflicting with wrappers of all batches, compilation may fail.",
+                  __FUNCTION__, qPrintable(files.at(index).typeEntry->qualifiedCppName()));
+    }
+
+    const QDir dir(directory);
+    for (int b = 0; b < batchCount; ++b) {
+        const auto &batch = batches.at(b);
+        FileOut file(directory + u'/' + baseName + QString::number(b) + u".cpp"_s);
+        TextStream &s = file.stream;
+        s.setLanguage(TextStream::Language::Cpp);
+        s << licenseComment() << "\n// Batch " << (b + 1) << " of " << batchCount
+            << " of module " << moduleName() << " (" << batch.files.size()
+            << " wrappers, " << batch.size << " bytes)\n\n";
+        for (auto index : batch.files)
+            s << "#include \"" << dir.relativeFilePath(files.at(index).filePath) << "\"\n";
+        file.done();
+    }
+
+    if (ReportHandler::isDebug(ReportHandler::MediumDebug)) {
+        for (int b = 0; b < batchCount; ++b) {
+            qCInfo(lcShiboken).noquote().nospace() << "Unity batch " << b << ": "
+                << batches.at(b).files.size() << " files, " << batches.at(b).size << " bytes";
+        }
+    }
+}
@@ -7,6 +7,7 @@
 #include <typesystem.h>
 
 #include <QtCore/QDebug>
+#include <QtCore/QMutex>
 #include <QtCore/QSet>
 
 static bool isCppPrimitiveString(const AbstractMetaType &type)
@@ -46,9 +47,12 @@ GeneratorArgument GeneratorArgument::fromMetaType(const AbstractMetaType &type)
                 result.type = Type::CppPrimitiveArray;
             } else {
                 static QSet<QString> warnedTypes;
+                static QBasicMutex warnedTypesMutex;
                 const QString &signature = type.cppSignature();
+                QMutexLocker locker(&warnedTypesMutex);
                 if (!warnedTypes.contains(signature)) {
                     warnedTypes.insert(signature);
+                    locker.unlock();
                     qWarning("%s", qPrintable(msgUnknownArrayPointerConversion(signature)));
                 }
                 result.indirections -= 1;
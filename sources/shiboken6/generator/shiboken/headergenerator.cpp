@@ -391,7 +391,7 @@ void HeaderGenerator::writeTypeIndexValueLine(TextStream &s, const ApiExtractorR
         // argument. Check against duplicate typedefs for the same types.
         const auto cType = std::static_pointer_cast<const ComplexTypeEntry>(typeEntry);
         if (cType->baseContainerType()) {
-            auto metaClass = AbstractMetaClass::findClass(api.classes(), cType);
+            auto metaClass = api.findClass(cType);
             Q_ASSERT(metaClass != nullptr);
             if (metaClass->isTypeDef()
                 && metaClass->templateBaseClass() != nullptr
@@ -6,6 +6,7 @@
 #include <abstractmetalang.h>
 #include <dotview.h>
 #include <reporthandler.h>
+#include <statistics.h>
 #include <complextypeentry.h>
 #include <containertypeentry.h>
 #include <primitivetypeentry.h>
@@ -243,7 +244,7 @@ void OverloadDataRootNode::sortNextOverloads(const ApiExtractorResult &api)
         // Process inheritance relationships
         if (targetType.isValue() || targetType.isObject()) {
             const auto te = targetType.typeEntry();
-            auto metaClass = AbstractMetaClass::findClass(api.classes(), te);
+            auto metaClass = api.findClass(te);
             if (!metaClass)
                 throw Exception(msgArgumentClassNotFound(m_overloads.constFirst(), te));
             const auto &ancestors = metaClass->allTypeSystemAncestors();
@@ -432,6 +433,8 @@ OverloadData::OverloadData(const AbstractMetaFunctionCList &overloads,
                            const ApiExtractorResult &api) :
     OverloadDataRootNode(overloads)
 {
+    StatisticsTimer timer(Statistics::Timer::OverloadData);
+    Statistics::increment(Statistics::Counter::OverloadData);
     for (const auto &func : overloads) {
         const auto minMaxArgs = getMinMaxArgs(func);
         if (minMaxArgs.first < m_minArgs)
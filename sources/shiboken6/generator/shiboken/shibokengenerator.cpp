@@ -41,9 +41,11 @@
 
 #include <QtCore/QDir>
 #include <QtCore/QDebug>
+#include <QtCore/QMutex>
 #include <QtCore/QRegularExpression>
 #include <limits>
 #include <memory>
+#include <unordered_map>
 
 using namespace Qt::StringLiterals;
 
@@ -55,6 +57,9 @@ static const char USE_OPERATOR_BOOL_AS_NB_NONZERO[] = "use-operator-bool-as-nb_n
 static const char WRAPPER_DIAGNOSTICS[] = "wrapper-diagnostics";
 static const char NO_IMPLICIT_CONVERSIONS[] = "no-implicit-conversions";
 static const char LEAN_HEADERS[] = "lean-headers";
+static const char UNITY_BATCHES[] = "unity-batches";
+static const char CALL_PROFILING[] = "call-profiling";
+static const char FREE_THREADING[] = "free-threading";
 
 const QString CPP_ARG = u"cppArg"_s;
 const QString CPP_ARG_REMOVED = u"removed_cppArg"_s;
@@ -78,9 +83,13 @@ struct GeneratorClassInfoCacheEntry
     bool needsGetattroFunction = false;
 };
 
-using GeneratorClassInfoCache = QHash<AbstractMetaClassCPtr, GeneratorClassInfoCacheEntry>;
+// The cache is filled by the generator threads (--jobs). The references to
+// entries returned by getGeneratorClassInfo() must stay valid on insertion.
+using GeneratorClassInfoCache = std::unordered_map<AbstractMetaClassCPtr,
+                                                   GeneratorClassInfoCacheEntry>;
 
 Q_GLOBAL_STATIC(GeneratorClassInfoCache, generatorClassInfoCache)
+static QBasicMutex generatorClassInfoCacheMutex;
 
 static const char CHECKTYPE_REGEX[] = R"(%CHECKTYPE\[([^\[]*)\]\()";
 static const char ISCONVERTIBLE_REGEX[] = R"(%ISCONVERTIBLE\[([^\[]*)\]\()";
@@ -1808,14 +1817,14 @@ ShibokenGenerator::AttroCheck
     return result;
 }
 
-bool ShibokenGenerator::classNeedsGetattroFunctionImpl(const AbstractMetaClassCPtr &metaClass)
+bool ShibokenGenerator::classNeedsGetattroFunctionImpl(const AbstractMetaClassCPtr &metaClass,
+                                                       const FunctionGroups &functionGroups)
 {
     if (!metaClass)
         return false;
     if (metaClass->typeEntry()->isSmartPointer())
         return true;
-    const auto &functionGroup = getFunctionGroups(metaClass);
-    for (auto it = functionGroup.cbegin(), end = functionGroup.cend(); it != end; ++it) {
+    for (auto it = functionGroups.cbegin(), end = functionGroups.cend(); it != end; ++it) {
         AbstractMetaFunctionCList overloads;
         for (const auto &func : std::as_const(it.value())) {
             if (func->isAssignmentOperator() || func->isConversionOperator()
@@ -1963,14 +1972,21 @@ ShibokenGenerator::FunctionGroups ShibokenGenerator::getGlobalFunctionGroups() c
 const GeneratorClassInfoCacheEntry &
     ShibokenGenerator::getGeneratorClassInfo(const AbstractMetaClassCPtr &scope)
 {
-    auto cache = generatorClassInfoCache();
-    auto it = cache->find(scope);
-    if (it == cache->end()) {
-        it = cache->insert(scope, {});
-        it.value().functionGroups = getFunctionGroupsImpl(scope);
-        it.value().needsGetattroFunction = classNeedsGetattroFunctionImpl(scope);
+    auto *cache = generatorClassInfoCache();
+    {
+        QMutexLocker locker(&generatorClassInfoCacheMutex);
+        auto it = cache->find(scope);
+        if (it != cache->end())
+            return it->second;
     }
-    return it.value();
+
+    GeneratorClassInfoCacheEntry entry;
+    entry.functionGroups = getFunctionGroupsImpl(scope);
+    entry.needsGetattroFunction = classNeedsGetattroFunctionImpl(scope, entry.functionGroups);
+
+    QMutexLocker locker(&generatorClassInfoCacheMutex);
+    // Keeps an entry inserted by another thread meanwhile
+    return cache->emplace(scope, std::move(entry)).first->second;
 }
 
 ShibokenGenerator::FunctionGroups
@@ -2128,7 +2144,15 @@ Generator::OptionDescriptions ShibokenGenerator::options() const
         {QLatin1StringView(NO_IMPLICIT_CONVERSIONS),
          u"Do not generate implicit_conversions for function arguments."_s},
         {QLatin1StringView(WRAPPER_DIAGNOSTICS),
-         u"Generate diagnostic code around wrappers"_s}
+         u"Generate diagnostic code around wrappers"_s},
+        {QLatin1StringView(CALL_PROFILING),
+         u"Generate code recording call counts and the time spent in C++ and\n"
+          "on releasing the GIL per function (see Shiboken.callProfile())"_s},
+        {QLatin1StringView(FREE_THREADING),
+         u"Declare the module as not using the GIL on free-threaded Python builds"_s},
+        {QLatin1StringView(UNITY_BATCHES) + u"=<number>"_s,
+         u"Generate the given number of batch source files including the\n"
+          "wrapper files, balanced by their size"_s}
     });
     return result;
 }
@@ -2155,6 +2179,15 @@ bool ShibokenGenerator::handleOption(const QString &key, const QString &value)
     }
     if (key == QLatin1StringView(WRAPPER_DIAGNOSTICS))
         return (m_wrapperDiagnostics = true);
+    if (key == QLatin1StringView(CALL_PROFILING))
+        return (m_callProfiling = true);
+    if (key == QLatin1StringView(FREE_THREADING))
+        return (m_freeThreading = true);
+    if (key == QLatin1StringView(UNITY_BATCHES)) {
+        bool ok;
+        m_unityBatches = value.toInt(&ok);
+        return ok && m_unityBatches >= 0;
+    }
     return false;
 }
 
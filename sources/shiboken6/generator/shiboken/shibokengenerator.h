@@ -83,6 +83,8 @@ public:
 protected:
     bool doSetup() override;
 
+    bool supportsParallelGeneration() const override { return true; }
+
     GeneratorContext contextForClass(const AbstractMetaClassCPtr &c) const override;
 
     /**
@@ -197,6 +199,8 @@ protected:
     static QString fullPythonFunctionName(const AbstractMetaFunctionCPtr &func, bool forceFunc);
 
     bool wrapperDiagnostics() const { return m_wrapperDiagnostics; }
+    bool callProfiling() const { return m_callProfiling; }
+    bool freeThreading() const { return m_freeThreading; }
 
     static QString protectedEnumSurrogateName(const AbstractMetaEnum &metaEnum);
 
@@ -290,6 +294,8 @@ protected:
     bool useOperatorBoolAsNbNonZero() const;
     /// Generate implicit conversions of function arguments
     bool generateImplicitConversions() const;
+    /// Number of batch translation units including the wrapper files (0: none)
+    int unityBatches() const { return m_unityBatches; }
     static QString cppApiVariableName(const QString &moduleName = QString());
     static QString pythonModuleObjectName(const QString &moduleName = QString());
     static QString convertersVariableName(const QString &moduleName = QString());
@@ -342,7 +348,8 @@ private:
     static const GeneratorClassInfoCacheEntry &
         getGeneratorClassInfo(const AbstractMetaClassCPtr &scope);
     static FunctionGroups getFunctionGroupsImpl(const AbstractMetaClassCPtr &scope);
-    static bool classNeedsGetattroFunctionImpl(const AbstractMetaClassCPtr &metaClass);
+    static bool classNeedsGetattroFunctionImpl(const AbstractMetaClassCPtr &metaClass,
+                                               const FunctionGroups &functionGroups);
 
     QString translateTypeForWrapperMethod(const AbstractMetaType &cType,
                                           const AbstractMetaClassCPtr &context,
@@ -455,6 +462,9 @@ private:
     // FIXME PYSIDE 7 Flip generateImplicitConversions default or remove?
     bool m_generateImplicitConversions = true;
     bool m_wrapperDiagnostics = false;
+    bool m_callProfiling = false;
+    bool m_freeThreading = false;
+    int m_unityBatches = 0;
 
     /// Type system converter variable replacement names and regular expressions.
     static const QHash<int, QString> &typeSystemConvName();
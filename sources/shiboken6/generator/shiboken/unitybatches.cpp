@@ -0,0 +1,57 @@
+// Copyright (C) 2026 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only WITH Qt-GPL-exception-1.0
+
+#include "unitybatches.h"
+
+#include <algorithm>
+#include <numeric>
+
+// A "using namespace" directive leaks into all wrappers following it in the
+// batch, so only wrappers using the same namespace (or none) are combined.
+// Native code injected into a class typically defines file-static helpers,
+// which clash when the same snippet is injected into several wrappers.
+static bool fitsInto(const UnityBatch &batch, const UnityBatchFile &file)
+{
+    return (batch.files.isEmpty() || batch.usingNamespace == file.usingNamespace)
+        && !batch.nativeCode.intersects(file.nativeCode);
+}
+
+// Largest first into the smallest batch that fits.
+QList<UnityBatch> distributeBatches(const QList<UnityBatchFile> &files, int batchCount,
+                                    QList<qsizetype> *conflicts)
+{
+    QList<UnityBatch> result(std::max(batchCount, 0));
+    if (result.isEmpty())
+        return result;
+    QList<qsizetype> order(files.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(), [&files](qsizetype i1, qsizetype i2) {
+        return files.at(i1).size > files.at(i2).size;
+    });
+
+    for (auto index : std::as_const(order)) {
+        const auto &file = files.at(index);
+        UnityBatch *batch = nullptr;
+        UnityBatch *conflictingBatch = nullptr;
+        for (auto &candidate : result) {
+            UnityBatch *&best = fitsInto(candidate, file) ? batch : conflictingBatch;
+            if (best == nullptr || candidate.size < best->size)
+                best = &candidate;
+        }
+        if (batch == nullptr) {
+            if (conflicts != nullptr)
+                conflicts->append(index);
+            batch = conflictingBatch;
+        }
+        if (batch->files.isEmpty())
+            batch->usingNamespace = file.usingNamespace;
+        batch->files.append(index);
+        batch->nativeCode.unite(file.nativeCode);
+        batch->size += file.size;
+    }
+
+    // Include the files in the order of generation
+    for (auto &batch : result)
+        std::sort(batch.files.begin(), batch.files.end());
+    return result;
+}
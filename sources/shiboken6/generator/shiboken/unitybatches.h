@@ -0,0 +1,36 @@
+// Copyright (C) 2026 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only WITH Qt-GPL-exception-1.0
+
+#ifndef UNITYBATCHES_H
+#define UNITYBATCHES_H
+
+#include <QtCore/QList>
+#include <QtCore/QSet>
+#include <QtCore/QString>
+
+// The properties of a wrapper file relevant for compiling it together with
+// other wrappers as one translation unit.
+struct UnityBatchFile
+{
+    qsizetype size = 0;
+    QString usingNamespace; // Namespace of a "using namespace" directive at file scope
+    QSet<QString> nativeCode; // Injected native code snippets
+};
+
+// A batch source file including a number of wrapper files.
+struct UnityBatch
+{
+    QList<qsizetype> files; // Indexes into the list of UnityBatchFile
+    QString usingNamespace;
+    QSet<QString> nativeCode;
+    qsizetype size = 0;
+};
+
+// Distribute the wrapper files onto batchCount batches by size. Wrappers
+// sharing native code snippets or using different namespaces are kept in
+// different batches where possible; the indexes of the files for which
+// this was not possible are returned in conflicts.
+QList<UnityBatch> distributeBatches(const QList<UnityBatchFile> &files, int batchCount,
+                                    QList<qsizetype> *conflicts = nullptr);
+
+#endif // UNITYBATCHES_H
@@ -13,11 +13,14 @@
 #include "sbkstaticstrings.h"
 #include "sbkstaticstrings_p.h"
 #include "autodecref.h"
+#include "criticalsection.h"
 #include "gilstate.h"
 #include <string>
 #include <cstring>
 #include <cstddef>
+#include <cstdint>
 #include <set>
+#include <vector>
 #include <sstream>
 #include <algorithm>
 #include "threadstatesaver.h"
@@ -35,6 +38,50 @@ namespace {
     void _destroyParentInfo(SbkObject *obj, bool keepReference);
 }
 
+// The parent/child relationships span several objects. On free-threaded
+// Python builds, they are protected by critical sections on a set of lock
+// objects (created in Shiboken::init()) selected by the address of the
+// wrapper, so that unrelated hierarchies can be modified in parallel.
+// Changing a relationship locks the entries of the child and of the parent.
+// References are released outside of the critical sections.
+#ifdef Py_GIL_DISABLED
+static constexpr std::size_t parentInfoLockCount = 64;
+static PyObject *parentInfoLocks[parentInfoLockCount];
+
+static PyObject *parentInfoLock(const SbkObject *object)
+{
+    auto hash = reinterpret_cast<std::uintptr_t>(object) >> 4; // Skip alignment bits
+    hash ^= hash >> 7;
+    return parentInfoLocks[hash % parentInfoLockCount];
+}
+#else
+static PyObject *parentInfoLock(const SbkObject *)
+{
+    return nullptr;
+}
+#endif
+
+// Returns the children of a parent holding a reference to each of them,
+// so that they can be visited without holding the lock.
+static std::vector<SbkObject *> takeChildrenSnapshot(SbkObject *parent)
+{
+    std::vector<SbkObject *> result;
+    Shiboken::CriticalSection section(parentInfoLock(parent));
+    const auto &children = parent->d->parentInfo->children;
+    result.reserve(children.size());
+    for (SbkObject *child : children) {
+        Py_INCREF(child);
+        result.push_back(child);
+    }
+    return result;
+}
+
+static void releaseChildrenSnapshot(const std::vector<SbkObject *> &children)
+{
+    for (SbkObject *child : children)
+        Py_DECREF(child);
+}
+
 static void callDestructor(const Shiboken::DtorAccumulatorVisitor::DestructorEntries &dts)
 {
     for (const auto &e : dts) {
@@ -644,11 +691,19 @@ void _destroyParentInfo(SbkObject *obj, bool keepReference)
 {
     Shiboken::ParentInfo *pInfo = obj->d->parentInfo;
     if (pInfo) {
-        while(!pInfo->children.empty()) {
-            SbkObject *first = *pInfo->children.begin();
+        while (true) {
+            SbkObject *first = nullptr;
+            {
+                Shiboken::CriticalSection section(parentInfoLock(obj));
+                if (pInfo->children.empty())
+                    break;
+                first = *pInfo->children.begin();
+                Py_INCREF(first); // Keep alive while the lock is not held
+            }
             // Mark child as invalid
             Shiboken::Object::invalidate(first);
             Shiboken::Object::removeParent(first, false, keepReference);
+            Py_DECREF(first);
         }
         Shiboken::Object::removeParent(obj, false);
     }
@@ -732,6 +787,11 @@ void init()
 
     VoidPtr::init();
 
+#ifdef Py_GIL_DISABLED
+    for (auto &lock : parentInfoLocks)
+        lock = PyDict_New();
+#endif
+
     shibokenAlreadInitialised = true;
 }
 
@@ -1202,7 +1262,7 @@ static void recursive_invalidate(SbkObject *self, std::set<SbkObject *> &seen)
     // If it is a parent invalidate all children.
     if (self->d->parentInfo) {
         // Create a copy because this list can be changed during the process
-        ChildrenList copy = self->d->parentInfo->children;
+        const auto copy = takeChildrenSnapshot(self);
 
         for (SbkObject *child : copy) {
             // invalidate the child
@@ -1212,6 +1272,7 @@ static void recursive_invalidate(SbkObject *self, std::set<SbkObject *> &seen)
             if (!self->d->validCppObject)
                 removeParent(child, true, true);
         }
+        releaseChildrenSnapshot(copy);
     }
 
     // If has ref to other objects invalidate all
@@ -1233,8 +1294,10 @@ void makeValid(SbkObject *self)
 
     // If it is a parent make  all children valid
     if (self->d->parentInfo) {
-        for (SbkObject *child : self->d->parentInfo->children)
+        const auto children = takeChildrenSnapshot(self);
+        for (SbkObject *child : children)
             makeValid(child);
+        releaseChildrenSnapshot(children);
     }
 
     // If has ref to other objects make all valid again
@@ -1359,17 +1422,21 @@ SbkObject *findColocatedChild(SbkObject *wrapper,
     if (!pInfo)
         return nullptr;
 
-    ChildrenList &children = pInfo->children;
-
-    for (SbkObject *child : children) {
-        if (!(child->d && child->d->cptr))
-            continue;
-        if (child->d->cptr[0] == wrapper->d->cptr[0]) {
-            return reinterpret_cast<const void *>(Py_TYPE(child)) == reinterpret_cast<const void *>(instanceType)
-                ? child : findColocatedChild(child, instanceType);
+    SbkObject *colocatedChild = nullptr;
+    {
+        CriticalSection section(parentInfoLock(wrapper));
+        for (SbkObject *child : pInfo->children) {
+            if (child->d && child->d->cptr && child->d->cptr[0] == wrapper->d->cptr[0]) {
+                colocatedChild = child;
+                break;
+            }
         }
     }
-    return nullptr;
+    if (colocatedChild == nullptr)
+        return nullptr;
+    // Recurse without holding the lock, which might be the same for the child.
+    return reinterpret_cast<const void *>(Py_TYPE(colocatedChild)) == reinterpret_cast<const void *>(instanceType)
+        ? colocatedChild : findColocatedChild(colocatedChild, instanceType);
 }
 
 PyObject *newObject(PyTypeObject *instanceType,
@@ -1472,21 +1539,32 @@ void destroy(SbkObject *self, void *cppData)
     // After this point the object can be death do not use the self pointer bellow
 }
 
-void removeParent(SbkObject *child, bool giveOwnershipBack, bool keepReference)
+// Returns the parent of a child as seen under the lock of the child. The
+// parent may be destroyed concurrently, so it must only be dereferenced
+// after locking it along with the child and verifying it is still the parent.
+static SbkObject *currentParent(SbkObject *child)
 {
+    CriticalSection section(parentInfoLock(child));
     ParentInfo *pInfo = child->d->parentInfo;
-    if (!pInfo || !pInfo->parent) {
-        if (pInfo && pInfo->hasWrapperRef) {
-            pInfo->hasWrapperRef = false;
-        }
-        return;
-    }
+    return pInfo != nullptr ? pInfo->parent : nullptr;
+}
+
+// Removes the child from its parent with both locked. Returns the number of
+// references to the child to be released by the caller outside of the locks
+// or -1 if the parent changed meanwhile.
+static int removeParentLocked(SbkObject *child, SbkObject *parent,
+                              bool giveOwnershipBack, bool keepReference)
+{
+    CriticalSection2 section(parentInfoLock(child), parentInfoLock(parent));
+    ParentInfo *pInfo = child->d->parentInfo;
+    if (pInfo == nullptr || pInfo->parent != parent)
+        return -1;
 
-    ChildrenList &oldBrothers = pInfo->parent->d->parentInfo->children;
+    ChildrenList &oldBrothers = parent->d->parentInfo->children;
     // Verify if this child is part of parent list
     auto iChild = oldBrothers.find(child);
     if (iChild == oldBrothers.end())
-        return;
+        return 0;
 
     oldBrothers.erase(iChild);
 
@@ -1497,17 +1575,38 @@ void removeParent(SbkObject *child, bool giveOwnershipBack, bool keepReference)
         child->d->containsCppWrapper) {
         //If have already a extra ref remove this one
         if (pInfo->hasWrapperRef)
-            Py_DECREF(child);
-        else
-            pInfo->hasWrapperRef = true;
-        return;
+            return 1;
+        pInfo->hasWrapperRef = true;
+        return 0;
     }
 
     // Transfer ownership back to Python
     child->d->hasOwnership = giveOwnershipBack;
 
     // Remove parent ref
-    Py_DECREF(child);
+    return 1;
+}
+
+void removeParent(SbkObject *child, bool giveOwnershipBack, bool keepReference)
+{
+    int releasedReferences = -1;
+    while (releasedReferences < 0) {
+        SbkObject *parent = currentParent(child);
+        if (parent == nullptr) {
+            CriticalSection section(parentInfoLock(child));
+            ParentInfo *pInfo = child->d->parentInfo;
+            if (pInfo == nullptr || pInfo->parent == nullptr) {
+                if (pInfo && pInfo->hasWrapperRef)
+                    pInfo->hasWrapperRef = false;
+                return;
+            }
+            continue; // Reparented meanwhile
+        }
+        releasedReferences = removeParentLocked(child, parent, giveOwnershipBack,
+                                                keepReference);
+    }
+    for (; releasedReferences > 0; --releasedReferences)
+        Py_DECREF(child);
 }
 
 void setParent(PyObject *parent, PyObject *child)
@@ -1534,39 +1633,44 @@ void setParent(PyObject *parent, PyObject *child)
     auto parent_ = reinterpret_cast<SbkObject *>(parent);
     auto child_ = reinterpret_cast<SbkObject *>(child);
 
-    if (!parentIsNull) {
-        if (!parent_->d->parentInfo)
-            parent_->d->parentInfo = new ParentInfo;
-
-        // do not re-add a child
-        if (child_->d->parentInfo && (child_->d->parentInfo->parent == parent_))
-            return;
-    }
-
-    ParentInfo *pInfo = child_->d->parentInfo;
-    bool hasAnotherParent = pInfo && pInfo->parent && pInfo->parent != parent_;
-
     //Avoid destroy child during reparent operation
     Py_INCREF(child);
 
-    // check if we need to remove this child from the old parent
-    if (parentIsNull || hasAnotherParent)
+    if (parentIsNull) {
         removeParent(child_);
+        Py_DECREF(child);
+        return;
+    }
+
+    while (true) {
+        {
+            CriticalSection2 section(parentInfoLock(child_), parentInfoLock(parent_));
+            if (!parent_->d->parentInfo)
+                parent_->d->parentInfo = new ParentInfo;
+
+            ParentInfo *pInfo = child_->d->parentInfo;
+            // do not re-add a child
+            if (pInfo && pInfo->parent == parent_)
+                break;
 
-    // Add the child to the new parent
-    pInfo = child_->d->parentInfo;
-    if (!parentIsNull) {
-        if (!pInfo)
-            pInfo = child_->d->parentInfo = new ParentInfo;
+            // Add the child to the new parent unless it has another one
+            if (!pInfo || !pInfo->parent) {
+                if (!pInfo)
+                    pInfo = child_->d->parentInfo = new ParentInfo;
 
-        pInfo->parent = parent_;
-        parent_->d->parentInfo->children.insert(child_);
+                pInfo->parent = parent_;
+                parent_->d->parentInfo->children.insert(child_);
 
-        // Add Parent ref
-        Py_INCREF(child_);
+                // Add Parent ref
+                Py_INCREF(child_);
 
-        // Remove ownership
-        child_->d->hasOwnership = false;
+                // Remove ownership
+                child_->d->hasOwnership = false;
+                break;
+            }
+        }
+        // Remove this child from the old parent and retry
+        removeParent(child_);
     }
 
     // Remove previous safe ref
@@ -1621,6 +1725,7 @@ static inline bool isNone(const PyObject *o)
 
 static void removeRefCountKey(SbkObject *self, const char *key)
 {
+    CriticalSection section(reinterpret_cast<PyObject *>(self));
     if (self->d->referredObjects) {
         const auto iterPair = self->d->referredObjects->equal_range(key);
         if (iterPair.first != iterPair.second) {
@@ -1637,6 +1742,7 @@ void keepReference(SbkObject *self, const char *key, PyObject *referredObject, b
         return;
     }
 
+    CriticalSection section(reinterpret_cast<PyObject *>(self));
     if (!self->d->referredObjects) {
         self->d->referredObjects =
             new Shiboken::RefCountMap{RefCountMap::value_type{key, referredObject}};
@@ -1668,6 +1774,7 @@ void removeReference(SbkObject *self, const char *key, PyObject *referredObject)
 
 void clearReferences(SbkObject *self)
 {
+    CriticalSection section(reinterpret_cast<PyObject *>(self));
     if (!self->d->referredObjects)
         return;
 
@@ -1737,9 +1844,9 @@ std::string info(SbkObject *self)
     }
 
     s << "hasOwnership...... " << bool(self->d->hasOwnership) << "\n"
-         "containsCppWrapper " << self->d->containsCppWrapper << "\n"
-         "validCppObject.... " << self->d->validCppObject << "\n"
-         "wasCreatedByPython " << self->d->cppObjectCreated << "\n";
+         "containsCppWrapper " << bool(self->d->containsCppWrapper) << "\n"
+         "validCppObject.... " << bool(self->d->validCppObject) << "\n"
+         "wasCreatedByPython " << bool(self->d->cppObjectCreated) << "\n";
 
 
     if (self->d->parentInfo && self->d->parentInfo->parent) {
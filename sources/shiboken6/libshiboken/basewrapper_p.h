@@ -7,6 +7,7 @@
 #include "sbkpython.h"
 #include "basewrapper.h"
 
+#include <atomic>
 #include <unordered_map>
 #include <set>
 #include <string>
@@ -53,17 +54,20 @@ struct SbkObjectPrivate
 {
     /// Pointer to the C++ class.
     void ** cptr;
+    // The flags are atomic since they can be modified from several threads
+    // on free-threaded Python builds; bit fields sharing one word would
+    // lose concurrent updates.
     /// True when Python is responsible for freeing the used memory.
-    unsigned int hasOwnership : 1;
+    std::atomic<bool> hasOwnership;
     /// This is true when the C++ class of the wrapped object has a virtual destructor AND was created by Python.
-    unsigned int containsCppWrapper : 1;
+    std::atomic<bool> containsCppWrapper;
     /// Marked as false when the object is lost to C++ and the binding can not know if it was deleted or not.
-    unsigned int validCppObject : 1;
+    std::atomic<bool> validCppObject;
     /// Marked as true when the object constructor was called
-    unsigned int cppObjectCreated : 1;
+    std::atomic<bool> cppObjectCreated;
     /// PYSIDE-1470: Marked as true if this is the Q*Application singleton.
     /// This bit allows app deletion from shiboken?.delete() .
-    unsigned int isQAppSingleton : 1;
+    std::atomic<bool> isQAppSingleton;
     /// Information about the object parents and children, may be null.
     Shiboken::ParentInfo *parentInfo;
     /// Manage reference count of objects that are referred to but not owned from.
@@ -0,0 +1,63 @@
+// Copyright (C) 2023 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#ifndef CRITICALSECTION_H
+#define CRITICALSECTION_H
+
+#include "sbkpython.h"
+
+namespace Shiboken
+{
+
+/// Locks the per-object mutex of a Python object on free-threaded Python
+/// builds (Py_GIL_DISABLED) for the lifetime of the instance. The GIL
+/// protects the object otherwise, and this class does nothing.
+/// Unlike a plain mutex, a critical section is suspended when the thread
+/// blocks (waiting for another lock, or running Python code), which
+/// prevents deadlocks when decreasing reference counts within it.
+class CriticalSection
+{
+public:
+    CriticalSection(const CriticalSection &) = delete;
+    CriticalSection(CriticalSection &&) = delete;
+    CriticalSection &operator=(const CriticalSection &) = delete;
+    CriticalSection &operator=(CriticalSection &&) = delete;
+
+#ifdef Py_GIL_DISABLED
+    explicit CriticalSection(PyObject *object) { PyCriticalSection_Begin(&m_section, object); }
+    ~CriticalSection() { PyCriticalSection_End(&m_section); }
+
+private:
+    PyCriticalSection m_section;
+#else
+    explicit CriticalSection(PyObject *) {}
+#endif
+};
+
+/// Locks the per-object mutexes of two Python objects (which may be
+/// identical) without risking lock order inversion, see CriticalSection.
+class CriticalSection2
+{
+public:
+    CriticalSection2(const CriticalSection2 &) = delete;
+    CriticalSection2(CriticalSection2 &&) = delete;
+    CriticalSection2 &operator=(const CriticalSection2 &) = delete;
+    CriticalSection2 &operator=(CriticalSection2 &&) = delete;
+
+#ifdef Py_GIL_DISABLED
+    explicit CriticalSection2(PyObject *object1, PyObject *object2)
+    {
+        PyCriticalSection2_Begin(&m_section, object1, object2);
+    }
+    ~CriticalSection2() { PyCriticalSection2_End(&m_section); }
+
+private:
+    PyCriticalSection2 m_section;
+#else
+    explicit CriticalSection2(PyObject *, PyObject *) {}
+#endif
+};
+
+} // namespace Shiboken
+
+#endif // CRITICALSECTION_H
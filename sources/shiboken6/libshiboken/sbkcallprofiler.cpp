@@ -0,0 +1,122 @@
+// Copyright (C) 2023 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#include "sbkcallprofiler.h"
+#include "autodecref.h"
+#include "sbkstring.h"
+
+#include <chrono>
+#include <mutex>
+
+namespace Shiboken::CallProfiler
+{
+
+static std::atomic<bool> enabled{true};
+static std::mutex entriesMutex;
+static Entry *firstEntry = nullptr;
+
+static inline int64_t now() noexcept
+{
+    using namespace std::chrono;
+    return duration_cast<nanoseconds>(steady_clock::now().time_since_epoch()).count();
+}
+
+Entry::Entry(const char *className, const char *signature, bool allowThread) :
+    className(className), signature(signature), allowThread(allowThread)
+{
+    std::lock_guard<std::mutex> guard(entriesMutex);
+    next = firstEntry;
+    firstEntry = this;
+}
+
+Scope::Scope(Entry *entry) noexcept :
+    m_entry(enabled.load(std::memory_order_relaxed) ? entry : nullptr)
+{
+    if (m_entry != nullptr)
+        m_start = m_callStart = m_callEnd = now();
+}
+
+Scope::~Scope()
+{
+    if (m_entry != nullptr) {
+        if (m_callEnd == m_start) // Exception thrown by the C++ function
+            callFinished();
+        finish();
+    }
+}
+
+void Scope::callStarted() noexcept
+{
+    if (m_entry != nullptr)
+        m_callStart = now();
+}
+
+void Scope::callFinished() noexcept
+{
+    if (m_entry != nullptr)
+        m_callEnd = now();
+}
+
+void Scope::finish() noexcept
+{
+    if (m_entry == nullptr)
+        return;
+    const int64_t end = now();
+    m_entry->calls.fetch_add(1, std::memory_order_relaxed);
+    m_entry->cppTimeNs.fetch_add(m_callEnd - m_callStart, std::memory_order_relaxed);
+    m_entry->gilTimeNs.fetch_add((m_callStart - m_start) + (end - m_callEnd),
+                                 std::memory_order_relaxed);
+    m_entry = nullptr;
+}
+
+void setEnabled(bool e)
+{
+    enabled.store(e);
+}
+
+bool isEnabled()
+{
+    return enabled.load();
+}
+
+static PyObject *entryToDict(const Entry *e)
+{
+    PyObject *result = PyDict_New();
+    Shiboken::AutoDecRef className(Shiboken::String::fromCString(e->className));
+    Shiboken::AutoDecRef signature(Shiboken::String::fromCString(e->signature));
+    Shiboken::AutoDecRef calls(PyLong_FromUnsignedLongLong(e->calls.load()));
+    Shiboken::AutoDecRef cppTime(PyFloat_FromDouble(double(e->cppTimeNs.load()) / 1e9));
+    Shiboken::AutoDecRef gilTime(PyFloat_FromDouble(double(e->gilTimeNs.load()) / 1e9));
+    PyDict_SetItemString(result, "class", className.object());
+    PyDict_SetItemString(result, "signature", signature.object());
+    PyDict_SetItemString(result, "allow_thread", e->allowThread ? Py_True : Py_False);
+    PyDict_SetItemString(result, "calls", calls.object());
+    PyDict_SetItemString(result, "cpp_time", cppTime.object());
+    PyDict_SetItemString(result, "gil_time", gilTime.object());
+    return result;
+}
+
+PyObject *statistics()
+{
+    PyObject *result = PyList_New(0);
+    std::lock_guard<std::mutex> guard(entriesMutex);
+    for (const Entry *e = firstEntry; e != nullptr; e = e->next) {
+        if (e->calls.load() > 0) {
+            Shiboken::AutoDecRef dict(entryToDict(e));
+            PyList_Append(result, dict.object());
+        }
+    }
+    return result;
+}
+
+void reset()
+{
+    std::lock_guard<std::mutex> guard(entriesMutex);
+    for (Entry *e = firstEntry; e != nullptr; e = e->next) {
+        e->calls.store(0);
+        e->cppTimeNs.store(0);
+        e->gilTimeNs.store(0);
+    }
+}
+
+} // namespace Shiboken::CallProfiler
@@ -0,0 +1,82 @@
+// Copyright (C) 2023 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#ifndef SBKCALLPROFILER_H
+#define SBKCALLPROFILER_H
+
+#include "sbkpython.h"
+#include "shibokenmacros.h"
+
+#include <atomic>
+#include <cstdint>
+
+/// Call statistics of wrapped functions. The wrappers generated with the
+/// "--call-profiling" option instantiate an Entry per C++ function and
+/// measure its calls using a Scope.
+namespace Shiboken::CallProfiler
+{
+
+struct LIBSHIBOKEN_API Entry
+{
+    Entry(const Entry &) = delete;
+    Entry(Entry &&) = delete;
+    Entry &operator=(const Entry &) = delete;
+    Entry &operator=(Entry &&) = delete;
+
+    /// \param className Qualified C++ name of the declaring class, empty for
+    ///        global functions
+    /// \param signature Minimal signature as used in the typesystem
+    /// \param allowThread Whether the wrapper releases the GIL
+    explicit Entry(const char *className, const char *signature, bool allowThread);
+
+    const char *className;
+    const char *signature;
+    const bool allowThread;
+    std::atomic<uint64_t> calls{0};
+    std::atomic<int64_t> cppTimeNs{0}; // Time spent in the C++ function
+    std::atomic<int64_t> gilTimeNs{0}; // Time spent releasing/acquiring the GIL
+    Entry *next = nullptr;
+};
+
+class LIBSHIBOKEN_API Scope
+{
+public:
+    Scope(const Scope &) = delete;
+    Scope(Scope &&) = delete;
+    Scope &operator=(const Scope &) = delete;
+    Scope &operator=(Scope &&) = delete;
+
+    /// Starts the measurement; to be instantiated before releasing the GIL.
+    explicit Scope(Entry *entry) noexcept;
+    /// Records the call unless finish() has been called (exceptions).
+    ~Scope();
+
+    /// To be called after releasing the GIL, directly before the C++ call
+    void callStarted() noexcept;
+    /// To be called after the C++ call, directly before acquiring the GIL
+    void callFinished() noexcept;
+    /// Records the call; to be called after acquiring the GIL
+    void finish() noexcept;
+
+private:
+    Entry *m_entry;
+    int64_t m_start = 0;
+    int64_t m_callStart = 0;
+    int64_t m_callEnd = 0;
+};
+
+/// Enables or disables recording (enabled by default).
+LIBSHIBOKEN_API void setEnabled(bool e);
+LIBSHIBOKEN_API bool isEnabled();
+
+/// Returns a list of dictionaries with the statistics of the functions
+/// that have been called ("class", "signature", "allow_thread", "calls",
+/// "cpp_time", "gil_time"; times in seconds).
+LIBSHIBOKEN_API PyObject *statistics();
+
+/// Resets the statistics.
+LIBSHIBOKEN_API void reset();
+
+} // namespace Shiboken::CallProfiler
+
+#endif // SBKCALLPROFILER_H
@@ -10,6 +10,7 @@
 #include "helper.h"
 #include "voidptr.h"
 
+#include <mutex>
 #include <string>
 #include <unordered_map>
 
@@ -17,6 +18,9 @@ static SbkConverter **PrimitiveTypeConverters;
 
 using ConvertersMap = std::unordered_map<std::string, SbkConverter *>;
 static ConvertersMap converters;
+// Protects the converter name map against concurrent registration and
+// lookup on free-threaded Python builds.
+static std::mutex convertersMutex;
 
 namespace Shiboken {
 namespace Conversions {
@@ -405,16 +409,23 @@ bool isImplicitConversion(PyTypeObject *type, PythonToCppFunc toCppFunc)
 
 void registerConverterName(SbkConverter *converter , const char *typeName)
 {
+    std::lock_guard<std::mutex> guard(convertersMutex);
     auto iter = converters.find(typeName);
     if (iter == converters.end())
         converters.insert(std::make_pair(typeName, converter));
 }
 
-SbkConverter *getConverter(const char *typeName)
+static SbkConverter *findConverter(const char *typeName)
 {
+    std::lock_guard<std::mutex> guard(convertersMutex);
     ConvertersMap::const_iterator it = converters.find(typeName);
-    if (it != converters.end())
-        return it->second;
+    return it != converters.end() ? it->second : nullptr;
+}
+
+SbkConverter *getConverter(const char *typeName)
+{
+    if (auto *converter = findConverter(typeName))
+        return converter;
     if (Shiboken::pyVerbose() > 0) {
         const std::string message =
             std::string("Can't find type resolver for type '") + typeName + "'.";
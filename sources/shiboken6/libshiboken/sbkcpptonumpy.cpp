@@ -40,6 +40,17 @@ PyObject *createIntArray1(Py_ssize_t size, const int *data)
     return _createArray1(size, NPY_INT, data);
 }
 
+PyObject *createInt64Array1(Py_ssize_t size, const int64_t *data)
+{
+    return _createArray1(size, NPY_INT64, data);
+}
+
+PyObject *createBoolArray1(Py_ssize_t size, const bool *data)
+{
+    static_assert(sizeof(bool) == sizeof(npy_bool));
+    return _createArray1(size, NPY_BOOL, data);
+}
+
 #else // HAVE_NUMPY
 
 PyObject *createByteArray1(Py_ssize_t, const uint8_t *)
@@ -62,6 +73,16 @@ PyObject *createIntArray1(Py_ssize_t, const int *)
     return Py_None;
 }
 
+PyObject *createInt64Array1(Py_ssize_t, const int64_t *)
+{
+    return Py_None;
+}
+
+PyObject *createBoolArray1(Py_ssize_t, const bool *)
+{
+    return Py_None;
+}
+
 #endif // !HAVE_NUMPY
 
 } //namespace Shiboken::Numpy
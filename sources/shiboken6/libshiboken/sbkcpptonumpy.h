@@ -36,6 +36,18 @@ LIBSHIBOKEN_API PyObject *createFloatArray1(Py_ssize_t size, const float *data);
 /// \return PyArrayObject
 LIBSHIBOKEN_API PyObject *createIntArray1(Py_ssize_t size, const int *data);
 
+/// Create a one-dimensional numpy array of type int64_t/NPY_INT64
+/// \param size Size
+/// \param data Data
+/// \return PyArrayObject
+LIBSHIBOKEN_API PyObject *createInt64Array1(Py_ssize_t size, const int64_t *data);
+
+/// Create a one-dimensional numpy array of type bool/NPY_BOOL
+/// \param size Size
+/// \param data Data
+/// \return PyArrayObject
+LIBSHIBOKEN_API PyObject *createBoolArray1(Py_ssize_t size, const bool *data);
+
 } //namespace Shiboken::Numpy
 
 #endif // SBKCPPTONUMPY_H
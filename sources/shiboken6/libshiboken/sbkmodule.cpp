@@ -4,6 +4,8 @@
 #include "sbkmodule.h"
 #include "basewrapper.h"
 #include "bindingmanager.h"
+
+#include <mutex>
 #include <unordered_map>
 
 /// This hash maps module objects to arrays of Python types.
@@ -15,6 +17,9 @@ using ModuleConvertersMap = std::unordered_map<PyObject *, SbkConverter **>;
 /// All types produced in imported modules are mapped here.
 static ModuleTypesMap moduleTypes;
 static ModuleConvertersMap moduleConverters;
+/// Protects the maps on free-threaded Python builds where modules can be
+/// imported from several threads concurrently.
+static std::mutex moduleMapsMutex;
 
 namespace Shiboken
 {
@@ -42,8 +47,21 @@ PyObject *create(const char * /* moduleName */, void *moduleData)
     return PyModule_Create(reinterpret_cast<PyModuleDef *>(moduleData));
 }
 
+int initDuplicate(PyObject *module, PyObject *initialModule)
+{
+    // Keep the attributes set by the import machinery (__spec__, __file__)
+    if (PyDict_Merge(PyModule_GetDict(module), PyModule_GetDict(initialModule), 0) != 0)
+        return -1;
+    if (auto *types = getTypes(initialModule))
+        registerTypes(module, types);
+    if (auto *converters = getTypeConverters(initialModule))
+        registerTypeConverters(module, converters);
+    return 0;
+}
+
 void registerTypes(PyObject *module, PyTypeObject **types)
 {
+    std::lock_guard<std::mutex> guard(moduleMapsMutex);
     auto iter = moduleTypes.find(module);
     if (iter == moduleTypes.end())
         moduleTypes.insert(std::make_pair(module, types));
@@ -51,12 +69,14 @@ void registerTypes(PyObject *module, PyTypeObject **types)
 
 PyTypeObject **getTypes(PyObject *module)
 {
+    std::lock_guard<std::mutex> guard(moduleMapsMutex);
     auto iter = moduleTypes.find(module);
     return (iter == moduleTypes.end()) ? 0 : iter->second;
 }
 
 void registerTypeConverters(PyObject *module, SbkConverter **converters)
 {
+    std::lock_guard<std::mutex> guard(moduleMapsMutex);
     auto iter = moduleConverters.find(module);
     if (iter == moduleConverters.end())
         moduleConverters.insert(std::make_pair(module, converters));
@@ -64,6 +84,7 @@ void registerTypeConverters(PyObject *module, SbkConverter **converters)
 
 SbkConverter **getTypeConverters(PyObject *module)
 {
+    std::lock_guard<std::mutex> guard(moduleMapsMutex);
     auto iter = moduleConverters.find(module);
     return (iter == moduleConverters.end()) ? 0 : iter->second;
 }
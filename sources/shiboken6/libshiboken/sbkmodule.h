@@ -26,10 +26,24 @@ LIBSHIBOKEN_API PyObject *import(const char *moduleName);
  *  Creates a new Python module named \p moduleName using the information passed in \p moduleData.
  *  In fact, \p moduleData expects a "PyMethodDef *" object, but that's for Python 2. A "void*"
  *  was preferred to make this work with future Python 3 support.
+ *  This is used for single-phase initialization; the generated modules use
+ *  multi-phase initialization. On free-threaded Python builds, the module
+ *  is not declared as running without the GIL; this is up to the caller
+ *  (PyUnstable_Module_SetGIL()).
  *  \returns a newly created module.
  */
 LIBSHIBOKEN_API PyObject *create(const char *moduleName, void *moduleData);
 
+/**
+ *  Initializes a further module object \p module created by the multi-phase
+ *  initialization of an already initialized module (when importing it again
+ *  after removing it from sys.modules or from a subinterpreter sharing the
+ *  GIL). The wrapper types can only be created once, so the attributes,
+ *  types and converters of the module object \p initialModule are shared.
+ *  \returns 0 on success, -1 with a Python error set on failure.
+ */
+LIBSHIBOKEN_API int initDuplicate(PyObject *module, PyObject *initialModule);
+
 /**
  *  Registers the list of types created by \p module.
  *  \param module   Module where the types were created.
@@ -27,6 +27,15 @@ bool check(PyObject *pyIn)
 #endif
 }
 
+bool isAvailable()
+{
+#ifdef HAVE_NUMPY
+    return PyArray_API != nullptr;
+#else
+    return false;
+#endif
+}
+
 } //namespace Shiboken::Numpy
 
 // Include all sources files using numpy so that they are in the same
@@ -21,6 +21,11 @@ namespace Shiboken::Numpy
 /// \return Whether it is a PyArrayObject
 LIBSHIBOKEN_API bool check(PyObject *pyIn);
 
+/// Check whether numpy support is compiled in and numpy could be imported,
+/// that is, whether the functions creating numpy arrays can be used.
+/// \return Whether numpy is available
+LIBSHIBOKEN_API bool isAvailable();
+
 } //namespace Shiboken::Numpy
 
 #ifndef PyArray_Check
@@ -55,11 +55,18 @@ static std::optional<View::Type> viewTypeFromNumPy(int npt)
 }
 
 View View::fromPyObject(PyObject *pyIn)
+{
+    return fromPyObject(pyIn, Layout::Contiguous);
+}
+
+View View::fromPyObject(PyObject *pyIn, Layout layout)
 {
     if (pyIn == nullptr || PyArray_Check(pyIn) == 0)
         return {};
     auto *ar = reinterpret_cast<PyArrayObject *>(pyIn);
-    if ((PyArray_FLAGS(ar) & NPY_ARRAY_C_CONTIGUOUS) == 0)
+    const int requiredFlags = layout == Layout::Contiguous
+        ? NPY_ARRAY_C_CONTIGUOUS : NPY_ARRAY_ALIGNED;
+    if ((PyArray_FLAGS(ar) & requiredFlags) != requiredFlags)
         return {};
     const int ndim = PyArray_NDIM(ar);
     if (ndim > 2)
@@ -219,6 +226,11 @@ View View::fromPyObject(PyObject *)
     return {};
 }
 
+View View::fromPyObject(PyObject *, Layout)
+{
+    return {};
+}
+
 std::ostream &operator<<(std::ostream &str, const debugPyArrayObject &)
 {
     str << "Unimplemented function " <<  __FUNCTION__ << ", (numpy was not found).";
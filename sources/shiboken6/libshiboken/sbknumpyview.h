@@ -17,14 +17,18 @@ namespace Shiboken::Numpy
 /// \return Whether it is a PyArrayObject
 LIBSHIBOKEN_API bool check(PyObject *pyIn);
 
-/// A simple view of an up to 2 dimensional, C-contiguous array of a standard
-/// type. It can be passed to compilation units that do not include the
-/// numpy headers.
+/// A simple view of an up to 2 dimensional array of a standard type,
+/// which is C-contiguous unless requested otherwise. It can be passed to
+/// compilation units that do not include the numpy headers.
 struct LIBSHIBOKEN_API View
 {
     enum Type { Int, Unsigned, Float, Double, Int16, Unsigned16, Int64, Unsigned64 };
+    /// Memory layouts accepted by fromPyObject(). For strided arrays,
+    /// the items need to be accessed using the stride.
+    enum class Layout { Contiguous, Strided };
 
     static View fromPyObject(PyObject *pyIn);
+    static View fromPyObject(PyObject *pyIn, Layout layout);
 
     operator bool() const { return ndim > 0; }
 
@@ -8,6 +8,7 @@
 #include "autodecref.h"
 #include "basewrapper.h"
 #include "bindingmanager.h"
+#include "criticalsection.h"
 #include "gilstate.h"
 #include "threadstatesaver.h"
 #include "helper.h"
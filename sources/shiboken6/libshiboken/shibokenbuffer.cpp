@@ -2,6 +2,9 @@
 // SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
 
 #include "shibokenbuffer.h"
+#include "basewrapper.h"
+#include "sbktypefactory.h"
+
 #include <cstdlib>
 #include <cstring>
 
@@ -68,3 +71,128 @@ PyObject *Shiboken::Buffer::newObject(const void *memory, Py_ssize_t size)
 {
     return newObject(const_cast<void *>(memory), size, ReadOnly);
 }
+
+// Exporter of the buffers created by newArrayObject(), holding the shape
+// and strides referenced by the views and the owner of the memory.
+extern "C"
+{
+
+struct SbkArrayExporter
+{
+    PyObject_HEAD
+    void *memory;
+    PyObject *owner;
+    char format[8];
+    Py_ssize_t itemSize;
+    Py_ssize_t len;
+    int ndim;
+    Py_ssize_t shape[Shiboken::Buffer::MaxDimensions];
+    Py_ssize_t strides[Shiboken::Buffer::MaxDimensions];
+    bool readOnly;
+    bool contiguous;
+};
+
+static int SbkArrayExporter_getbuffer(PyObject *obj, Py_buffer *view, int flags)
+{
+    auto *exporter = reinterpret_cast<SbkArrayExporter *>(obj);
+    if ((flags & PyBUF_WRITABLE) == PyBUF_WRITABLE && exporter->readOnly) {
+        PyErr_SetString(PyExc_BufferError, "Buffer is read-only.");
+        return -1;
+    }
+    const bool nd = (flags & PyBUF_ND) == PyBUF_ND;
+    const bool strided = (flags & PyBUF_STRIDES) == PyBUF_STRIDES;
+    const int contiguityFlags = PyBUF_C_CONTIGUOUS | PyBUF_F_CONTIGUOUS | PyBUF_ANY_CONTIGUOUS;
+    if (!exporter->contiguous
+        && (!strided || (flags & contiguityFlags & ~PyBUF_STRIDES) != 0)) {
+        PyErr_SetString(PyExc_BufferError, "Buffer is not contiguous, strides are required.");
+        return -1;
+    }
+
+    view->obj = obj;
+    Py_INCREF(obj);
+    view->buf = exporter->memory;
+    view->len = exporter->len;
+    view->readonly = exporter->readOnly ? 1 : 0;
+    view->itemsize = exporter->itemSize;
+    view->format = (flags & PyBUF_FORMAT) == PyBUF_FORMAT ? exporter->format : nullptr;
+    view->ndim = nd ? exporter->ndim : 1;
+    view->shape = nd ? exporter->shape : nullptr;
+    view->strides = strided ? exporter->strides : nullptr;
+    view->suboffsets = nullptr;
+    view->internal = nullptr;
+    return 0;
+}
+
+static void SbkArrayExporter_dealloc(PyObject *self)
+{
+    auto *exporter = reinterpret_cast<SbkArrayExporter *>(self);
+    Py_XDECREF(exporter->owner);
+    Sbk_object_dealloc(self);
+}
+
+static PyBufferProcs SbkArrayExporterBufferProc = {
+    (getbufferproc)SbkArrayExporter_getbuffer,  // bf_getbuffer
+    (releasebufferproc)nullptr                  // bf_releasebuffer
+};
+
+static PyType_Slot SbkArrayExporterType_slots[] = {
+    {Py_tp_dealloc, reinterpret_cast<void *>(SbkArrayExporter_dealloc)},
+    {0, nullptr}
+};
+
+static PyType_Spec SbkArrayExporterType_spec = {
+    "2:shiboken6.Shiboken.ArrayExporter",
+    sizeof(SbkArrayExporter),
+    0,
+    Py_TPFLAGS_DEFAULT,
+    SbkArrayExporterType_slots,
+};
+
+} // extern "C"
+
+static PyTypeObject *SbkArrayExporter_TypeF()
+{
+    static PyTypeObject *type = SbkType_FromSpec_BMDWB(&SbkArrayExporterType_spec,
+                                                       nullptr, nullptr, 0, 0,
+                                                       &SbkArrayExporterBufferProc);
+    return type;
+}
+
+PyObject *Shiboken::Buffer::newArrayObject(void *memory, const char *format,
+                                           Py_ssize_t itemSize, int ndim,
+                                           const Py_ssize_t *shape,
+                                           const Py_ssize_t *strides,
+                                           Type type, PyObject *owner)
+{
+    if (ndim < 1 || ndim > MaxDimensions || itemSize <= 0
+        || std::strlen(format) >= sizeof(SbkArrayExporter::format)) {
+        PyErr_SetString(PyExc_ValueError, "Invalid array buffer layout.");
+        return nullptr;
+    }
+
+    auto *exporter = PyObject_New(SbkArrayExporter, SbkArrayExporter_TypeF());
+    if (exporter == nullptr)
+        return nullptr;
+    exporter->memory = memory;
+    exporter->owner = owner;
+    Py_XINCREF(owner);
+    std::strcpy(exporter->format, format);
+    exporter->itemSize = itemSize;
+    exporter->ndim = ndim;
+    exporter->readOnly = type == ReadOnly;
+    exporter->len = itemSize;
+    Py_ssize_t expectedStride = itemSize; // C-contiguity
+    exporter->contiguous = true;
+    for (int d = ndim - 1; d >= 0; --d) {
+        exporter->shape[d] = shape[d];
+        exporter->strides[d] = strides[d];
+        exporter->len *= shape[d];
+        if (shape[d] > 1 && strides[d] != expectedStride)
+            exporter->contiguous = false;
+        expectedStride *= shape[d];
+    }
+
+    PyObject *result = PyMemoryView_FromObject(reinterpret_cast<PyObject *>(exporter));
+    Py_DECREF(exporter);
+    return result;
+}
@@ -30,6 +30,22 @@ namespace Buffer
      */
     LIBSHIBOKEN_API PyObject *newObject(const void *memory, Py_ssize_t size);
 
+    /// Maximum number of dimensions supported by newArrayObject()
+    constexpr int MaxDimensions = 4;
+
+    /**
+     * Creates a new Python buffer of \p ndim dimensions pointing to the memory
+     * block at \p memory with the given \p shape and \p strides (in bytes).
+     * The items are described by \p format in struct module syntax.
+     * A reference to \p owner is held as long as the buffer exists,
+     * which can be used to tie the lifetime of the memory to a wrapper.
+     */
+    LIBSHIBOKEN_API PyObject *newArrayObject(void *memory, const char *format,
+                                             Py_ssize_t itemSize, int ndim,
+                                             const Py_ssize_t *shape,
+                                             const Py_ssize_t *strides,
+                                             Type type, PyObject *owner);
+
     /**
      * Check if is ok to use \p pyObj as argument in all function under Shiboken::Buffer namespace.
      */
@@ -10,8 +10,31 @@
 extern "C"
 {
 
+/// Parameter of a function signature written by the generator. The
+/// annotation and the default value are unresolved Python expressions.
+struct SbkSignatureParameter
+{
+    const char *name;
+    const char *annotation;
+    const char *defaultValue; // nullptr if there is none
+};
+
+/// Function signature written by the generator. The overloads of a function
+/// have consecutive entries whose index (multi) counts down to 0, single
+/// functions have -1. A table is terminated by an entry without function name.
+struct SbkSignature
+{
+    int multi;
+    const char *funcName;
+    const SbkSignatureParameter *parameters;
+    int parameterCount;
+    const char *returnType; // nullptr if there is none
+};
+
 LIBSHIBOKEN_API int InitSignatureStrings(PyTypeObject *, const char *[]);
 LIBSHIBOKEN_API void FinishSignatureInitialization(PyObject *, const char *[]);
+LIBSHIBOKEN_API int InitSignatureTable(PyTypeObject *, const SbkSignature *);
+LIBSHIBOKEN_API void FinishSignatureTableInitialization(PyObject *, const SbkSignature *);
 LIBSHIBOKEN_API void SetError_Argument(PyObject *, const char *, PyObject *);
 LIBSHIBOKEN_API PyObject *Sbk_TypeGet___doc__(PyObject *);
 LIBSHIBOKEN_API PyObject *GetFeatureDict();
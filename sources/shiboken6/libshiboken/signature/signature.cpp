@@ -305,6 +305,8 @@ PyMethodDef signature_methods[] = {
     {"__feature_import__", (PyCFunction)feature_import, METH_VARARGS | METH_KEYWORDS, nullptr},
     {"get_signature", (PyCFunction)get_signature, METH_VARARGS,
         "get the signature, passing an optional string parameter"},
+    {"parse_signature_line", (PyCFunction)parse_signature_line, METH_O,
+        "split a signature string into name, arguments and return type"},
     {nullptr, nullptr, 0, nullptr}
 };
 
@@ -316,8 +318,8 @@ PyMethodDef signature_methods[] = {
 // * PySide_BuildSignatureArgs
 //
 // Called during class or module initialization.
-// The signature strings from the C modules are stored in a dict for
-// later use.
+// The signature tables or strings from the C modules are stored in a dict
+// for later use.
 //
 // * PySide_BuildSignatureProps
 //
@@ -326,7 +328,8 @@ PyMethodDef signature_methods[] = {
 // The parsed properties can then be used to create signature objects.
 //
 
-static int PySide_BuildSignatureArgs(PyObject *obtype_mod, const char *signatures[])
+static int PySide_BuildSignatureArgs(PyObject *obtype_mod, const char *signatures[],
+                                     const SbkSignature *table = nullptr)
 {
     AutoDecRef type_key(GetTypeKey(obtype_mod));
     /*
@@ -335,11 +338,18 @@ static int PySide_BuildSignatureArgs(PyObject *obtype_mod, const char *signature
      * Instead of one huge string, we take a ssize_t that is the
      * address of a string array. It will not be turned into a real
      * string list until really used by Python. This is quite optimal.
+     * Tables are looked up in the registry of signature_table.cpp.
      */
-    AutoDecRef numkey(Py_BuildValue("n", signatures));
+    AutoDecRef numkey(table != nullptr ? Py_BuildValue("n", table)
+                                       : Py_BuildValue("n", signatures));
     if (type_key.isNull() || numkey.isNull()
         || PyDict_SetItem(pyside_globals->arg_dict, type_key, numkey) < 0)
         return -1;
+    // Keep the signatures for the native error messages.
+    if (table != nullptr)
+        RegisterSignatureTable(obtype_mod, type_key, table);
+    else
+        RegisterSignatureStrings(obtype_mod, type_key, signatures);
     /*
      * We record also a mapping from type key to type/module. This helps to
      * lazily initialize the Py_LIMITED_API in name_key_to_func().
@@ -358,7 +368,13 @@ PyObject *PySide_BuildSignatureProps(PyObject *type_key)
     if (type_key == nullptr)
         return nullptr;
     PyObject *numkey = PyDict_GetItem(pyside_globals->arg_dict, type_key);
-    AutoDecRef strings(_address_to_stringlist(numkey));
+    // The signatures of a table are passed already split.
+    AutoDecRef strings(SignatureTableAsList(type_key));
+    if (strings.isNull()) {
+        if (PyErr_Occurred())
+            return nullptr;
+        strings.reset(_address_to_stringlist(numkey));
+    }
     if (strings.isNull())
         return nullptr;
     AutoDecRef arg_tup(Py_BuildValue("(OO)", type_key, strings.object()));
@@ -395,7 +411,8 @@ static bool get_lldebug_flag()
 
 #endif
 
-static int PySide_FinishSignatures(PyObject *module, const char *signatures[])
+static int PySide_FinishSignatures(PyObject *module, const char *signatures[],
+                                   const SbkSignature *table = nullptr)
 {
 #ifdef PYPY_VERSION
     static const bool have_problem = get_lldebug_flag();
@@ -410,7 +427,7 @@ static int PySide_FinishSignatures(PyObject *module, const char *signatures[])
         return -1;
 
     // we abuse the call for types, since they both have a __name__ attribute.
-    if (PySide_BuildSignatureArgs(module, signatures) < 0)
+    if (PySide_BuildSignatureArgs(module, signatures, table) < 0)
         return -1;
 
     /*
@@ -449,11 +466,12 @@ static int PySide_FinishSignatures(PyObject *module, const char *signatures[])
 // These are exactly the supported functions from `signature.h`.
 //
 
-int InitSignatureStrings(PyTypeObject *type, const char *signatures[])
+static int initSignatures(PyTypeObject *type, const char *signatures[],
+                          const SbkSignature *table)
 {
     init_shibokensupport_module();
     auto *ob_type = reinterpret_cast<PyObject *>(type);
-    int ret = PySide_BuildSignatureArgs(ob_type, signatures);
+    int ret = PySide_BuildSignatureArgs(ob_type, signatures, table);
     if (ret < 0) {
         PyErr_Print();
         PyErr_SetNone(PyExc_ImportError);
@@ -461,7 +479,18 @@ int InitSignatureStrings(PyTypeObject *type, const char *signatures[])
     return ret;
 }
 
-void FinishSignatureInitialization(PyObject *module, const char *signatures[])
+int InitSignatureStrings(PyTypeObject *type, const char *signatures[])
+{
+    return initSignatures(type, signatures, nullptr);
+}
+
+int InitSignatureTable(PyTypeObject *type, const SbkSignature *signatures)
+{
+    return initSignatures(type, nullptr, signatures);
+}
+
+static void finishSignatureInitialization(PyObject *module, const char *signatures[],
+                                          const SbkSignature *table)
 {
     /*
      * This function is called at the very end of a module initialization.
@@ -480,12 +509,22 @@ void FinishSignatureInitialization(PyObject *module, const char *signatures[])
 #endif
 
     if ((patch_types && PySide_PatchTypes() < 0)
-        || PySide_FinishSignatures(module, signatures) < 0) {
+        || PySide_FinishSignatures(module, signatures, table) < 0) {
         PyErr_Print();
         PyErr_SetNone(PyExc_ImportError);
     }
 }
 
+void FinishSignatureInitialization(PyObject *module, const char *signatures[])
+{
+    finishSignatureInitialization(module, signatures, nullptr);
+}
+
+void FinishSignatureTableInitialization(PyObject *module, const SbkSignature *signatures)
+{
+    finishSignatureInitialization(module, nullptr, signatures);
+}
+
 static PyObject *adjustFuncName(const char *func_name)
 {
     /*
@@ -575,7 +614,8 @@ void SetError_Argument(PyObject *args, const char *func_name, PyObject *info)
     /*
      * This function replaces the type error construction with extra
      * overloads parameter in favor of using the signature module.
-     * Error messages are rare, so we do it completely in Python.
+     * The common cases are handled natively from the signature strings,
+     * everything else is done in Python.
      */
 
     // PYSIDE-1305: Handle errors set by fillQtProperties.
@@ -587,6 +627,9 @@ void SetError_Argument(PyObject *args, const char *func_name, PyObject *info)
         info = v;
         Py_XDECREF(t);
     }
+    // Most wrong argument errors can be reported without the Python parser.
+    if (SetError_Argument_Native(args, func_name, info))
+        return;
     // PYSIDE-1019: Modify the function name expression according to feature.
     AutoDecRef new_func_name(adjustFuncName(func_name));
     if (new_func_name.isNull()) {
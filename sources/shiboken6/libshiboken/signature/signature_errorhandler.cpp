@@ -0,0 +1,713 @@
+// Copyright (C) 2023 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+////////////////////////////////////////////////////////////////////////////
+//
+// signature_errorhandler.cpp
+// --------------------------
+//
+// This is a native version of `errorhandler.py`. It creates the error
+// messages about wrong arguments directly from the signature table of
+// the generated modules (see `signature_table.cpp`). Only the signatures
+// of the failing function are resolved, using the type mapping of the
+// signature module (`mapping.py`) the same way as `parser.py` and
+// `layout.py` do. This avoids initializing the signature of the whole
+// type in Python for each error.
+//
+// Whenever something cannot be decided reliably here (active features,
+// expressions which cannot be evaluated natively, types which cannot be
+// checked natively, verbose mode), the message is left to
+// `errorhandler.py` by returning false.
+//
+
+#include "signature_p.h"
+
+#include "autodecref.h"
+#include "helper.h"
+#include "sbkfeature_base.h"
+#include "sbkstaticstrings.h"
+#include "sbkstring.h"
+
+#include <algorithm>
+#include <cctype>
+#include <cstring>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+using namespace Shiboken;
+
+namespace {
+
+enum class Match { No, Yes, Unknown };
+
+// The objects of the Python signature support needed to resolve and
+// format the signatures like `parser.py` and `layout.py` do.
+struct SignatureSupport
+{
+    bool init();
+
+    AutoDecRef typeMap;
+    AutoDecRef nameSpace;
+    AutoDecRef parserGlobals;
+    AutoDecRef builtins;
+    AutoDecRef defaultType;
+    AutoDecRef instanceType;
+    AutoDecRef resultVariableType;
+    AutoDecRef arrayLikeVariableType;
+    AutoDecRef typingAny;
+    AutoDecRef typingUnion;
+    AutoDecRef typingOptional;
+    AutoDecRef typingSequence;
+    AutoDecRef abcSequence;
+    AutoDecRef abcIterable;
+    AutoDecRef formatAnnotation;
+};
+
+} // namespace
+
+static bool startsWith(std::string_view s, std::string_view prefix)
+{
+    return s.size() >= prefix.size() && s.compare(0, prefix.size(), prefix) == 0;
+}
+
+static bool endsWith(std::string_view s, std::string_view suffix)
+{
+    return s.size() >= suffix.size()
+        && s.compare(s.size() - suffix.size(), suffix.size(), suffix) == 0;
+}
+
+static PyObject *fromStringView(std::string_view s)
+{
+    return PyUnicode_FromStringAndSize(s.data(), Py_ssize_t(s.size()));
+}
+
+// Returns an attribute of an already loaded module
+static PyObject *moduleAttribute(const char *moduleName, const char *name)
+{
+    PyObject *module = PyDict_GetItemString(PyImport_GetModuleDict(), moduleName);
+    if (module == nullptr)
+        return nullptr;
+    PyObject *result = PyObject_GetAttrString(module, name);
+    if (result == nullptr)
+        PyErr_Clear();
+    return result;
+}
+
+bool SignatureSupport::init()
+{
+    static const char mappingModule[] = "shibokensupport.signature.mapping";
+    AutoDecRef updateMapping(moduleAttribute(mappingModule, "update_mapping"));
+    if (updateMapping.isNull())
+        return false;
+    AutoDecRef updated(PyObject_CallObject(updateMapping, nullptr));
+    if (updated.isNull()) {
+        PyErr_Clear();
+        return false;
+    }
+    typeMap.reset(moduleAttribute(mappingModule, "type_map"));
+    nameSpace.reset(moduleAttribute(mappingModule, "namespace"));
+    parserGlobals.reset(moduleAttribute("shibokensupport.signature.parser", "__dict__"));
+    builtins.reset(moduleAttribute("builtins", "__dict__"));
+    defaultType.reset(moduleAttribute(mappingModule, "Default"));
+    instanceType.reset(moduleAttribute(mappingModule, "Instance"));
+    resultVariableType.reset(moduleAttribute(mappingModule, "ResultVariable"));
+    arrayLikeVariableType.reset(moduleAttribute(mappingModule, "ArrayLikeVariable"));
+    typingAny.reset(moduleAttribute("typing", "Any"));
+    typingUnion.reset(moduleAttribute("typing", "Union"));
+    typingOptional.reset(moduleAttribute("typing", "Optional"));
+    typingSequence.reset(moduleAttribute("typing", "Sequence"));
+    abcSequence.reset(moduleAttribute("collections.abc", "Sequence"));
+    abcIterable.reset(moduleAttribute("collections.abc", "Iterable"));
+    formatAnnotation.reset(moduleAttribute("inspect", "formatannotation"));
+    for (const auto *o : {&typeMap, &nameSpace, &parserGlobals, &builtins,
+                          &defaultType, &instanceType, &resultVariableType,
+                          &arrayLikeVariableType, &typingAny, &typingUnion,
+                          &typingOptional, &typingSequence, &abcSequence,
+                          &abcIterable, &formatAnnotation}) {
+        if (o->isNull())
+            return false;
+    }
+    return PyDict_Check(typeMap.object()) && PyDict_Check(nameSpace.object())
+        && PyDict_Check(parserGlobals.object()) && PyDict_Check(builtins.object());
+}
+
+static bool isInstance(PyObject *o, PyObject *type)
+{
+    const int result = PyObject_IsInstance(o, type);
+    if (result < 0)
+        PyErr_Clear();
+    return result > 0;
+}
+
+static bool isSelf(const Signature::Parameter &parameter)
+{
+    return parameter.name == parameter.annotation
+        && (parameter.name == "self" || parameter.name == "cls");
+}
+
+// Looks up a text in the `type_map` of `mapping.py`, returns a borrowed reference
+static PyObject *typeMapItem(SignatureSupport &support, std::string_view text)
+{
+    AutoDecRef key(fromStringView(text));
+    return key.isNull() ? nullptr : PyDict_GetItem(support.typeMap, key);
+}
+
+static PyObject *evalNumber(std::string_view text)
+{
+    const std::string number(text);
+    char *end{};
+    PyObject *result = PyLong_FromString(number.c_str(), &end, 0);
+    if (result != nullptr && *end == '\0')
+        return result;
+    Py_XDECREF(result);
+    PyErr_Clear();
+    // A float literal must have a fraction or an exponent ("08" is invalid).
+    if (number.find_first_of(".eE") == std::string::npos
+        || number.find_first_of("xX") != std::string::npos) {
+        return nullptr;
+    }
+    AutoDecRef str(fromStringView(text));
+    result = PyFloat_FromString(str);
+    if (result == nullptr)
+        PyErr_Clear();
+    return result;
+}
+
+static bool isDottedName(std::string_view text)
+{
+    bool componentStart = true;
+    for (char c : text) {
+        const auto uc = static_cast<unsigned char>(c);
+        if (c == '.') {
+            if (componentStart)
+                return false;
+            componentStart = true;
+        } else if (std::isalpha(uc) != 0 || c == '_' || (!componentStart && std::isdigit(uc) != 0)) {
+            componentStart = false;
+        } else {
+            return false;
+        }
+    }
+    return !componentStart;
+}
+
+// Corresponds to `eval(thing, globals(), namespace)` of `parser.py` for the
+// expressions which can be evaluated natively: Number literals and dotted
+// names. Returns null for anything else.
+static PyObject *evalExpression(SignatureSupport &support, std::string_view text)
+{
+    if (text.empty())
+        return nullptr;
+    const auto number = text.front() == '-' ? text.substr(1) : text;
+    if (!number.empty() && (number.front() == '.'
+                            || std::isdigit(static_cast<unsigned char>(number.front())) != 0)) {
+        return evalNumber(text);
+    }
+    if (!isDottedName(text))
+        return nullptr;
+    const size_t dot = text.find('.');
+    const std::string head(text.substr(0, dot));
+    PyObject *result{};
+    if (head == "None")
+        result = Py_None;
+    else if (head == "True")
+        result = Py_True;
+    else if (head == "False")
+        result = Py_False;
+    for (PyObject *dict : {support.nameSpace.object(), support.parserGlobals.object(),
+                           support.builtins.object()}) {
+        if (result == nullptr)
+            result = PyDict_GetItemString(dict, head.c_str());
+    }
+    if (result == nullptr)
+        return nullptr;
+    Py_INCREF(result);
+    auto rest = dot != std::string_view::npos ? text.substr(dot + 1) : std::string_view{};
+    while (!rest.empty() && result != nullptr) {
+        const size_t next = rest.find('.');
+        const std::string component(rest.substr(0, next));
+        PyObject *attribute = PyObject_GetAttrString(result, component.c_str());
+        Py_DECREF(result);
+        result = attribute;
+        rest = next != std::string_view::npos ? rest.substr(next + 1) : std::string_view{};
+    }
+    if (result == nullptr)
+        PyErr_Clear();
+    return result;
+}
+
+// Creates a `Default("X")` or `Instance("X")` of `mapping.py`
+static PyObject *notCalled(PyObject *type, std::string_view text)
+{
+    if (text.find_first_of("\"\\") != std::string_view::npos)
+        return nullptr;
+    AutoDecRef str(fromStringView(text));
+    PyObject *result = PyObject_CallFunctionObjArgs(type, str.object(), nullptr);
+    if (result == nullptr)
+        PyErr_Clear();
+    return result;
+}
+
+// Corresponds to `get_name()` of `parser.py`
+static std::optional<std::string> typeMapName(PyObject *o)
+{
+    AutoDecRef name(PyType_Check(o) ? PyObject_GetAttr(o, PyMagicName::qualname())
+                                    : PyObject_GetAttr(o, PyMagicName::name()));
+    if (name.isNull()) {
+        PyErr_Clear();
+        // typing.Any: '_SpecialForm' object has no attribute '__name__'
+        name.reset(PyObject_Str(o));
+    }
+    if (name.isNull() || !PyUnicode_Check(name.object())) {
+        PyErr_Clear();
+        return std::nullopt;
+    }
+    return std::string(String::toCString(name));
+}
+
+// Corresponds to `_resolve_value()` of `parser.py` for a default value
+// of a parameter annotated with `valtype`.
+static PyObject *resolveDefault(SignatureSupport &support, std::string_view thing,
+                                std::string_view valtype)
+{
+    std::string text(thing);
+    if (thing == "0" || thing == "None") {
+        if (startsWith(valtype, "PySide6.") || startsWith(valtype, "typing."))
+            Py_RETURN_NONE;
+        PyObject *mapped = typeMapItem(support, valtype);
+        if (mapped == nullptr)
+            return nullptr;
+        const auto name = typeMapName(mapped);
+        if (!name.has_value())
+            return nullptr;
+        text = "zero(" + name.value() + ')';
+    }
+    if (PyObject *mapped = typeMapItem(support, text)) {
+        Py_INCREF(mapped);
+        return mapped;
+    }
+    // `make_good_value()`
+    if (endsWith(text, "()"))
+        return notCalled(support.defaultType, std::string_view(text).substr(0, text.size() - 2));
+    AutoDecRef result(evalExpression(support, text));
+    if (result.isNull())
+        return nullptr;
+    AutoDecRef repr(PyObject_Repr(result));
+    if (repr.isNull()) {
+        PyErr_Clear();
+        return nullptr;
+    }
+    if (String::toCString(repr)[0] == '<')
+        return notCalled(support.instanceType, text);
+    return result.release();
+}
+
+// Corresponds to `handle_argvar()` of `parser.py`, steals the reference.
+static PyObject *handleArgVar(SignatureSupport &support, PyObject *o)
+{
+    if (o == nullptr)
+        return nullptr;
+    AutoDecRef object(o);
+    if (isInstance(o, support.arrayLikeVariableType)) {
+        AutoDecRef type(PyObject_GetAttrString(o, "type"));
+        PyObject *result = type.isNull()
+            ? nullptr : PyObject_GetItem(support.typingSequence, type);
+        if (result == nullptr)
+            PyErr_Clear();
+        return result;
+    }
+    if (PyType_Check(o) && PyObject_IsSubclass(o, support.arrayLikeVariableType) > 0) {
+        Py_INCREF(support.typingSequence.object());
+        return support.typingSequence.object();
+    }
+    PyErr_Clear();
+    return object.release();
+}
+
+// Matches the primitive arrays "int[3]", "int[]" (see `_resolve_arraytype()`)
+static bool isArrayType(std::string_view type)
+{
+    const size_t open = type.rfind('[');
+    if (open == std::string_view::npos || type.back() != ']')
+        return false;
+    const auto digits = type.substr(open + 1, type.size() - open - 2);
+    return std::all_of(digits.cbegin(), digits.cend(),
+                       [](char c) { return std::isdigit(static_cast<unsigned char>(c)) != 0; });
+}
+
+// Corresponds to `_resolve_type()` of `parser.py` with `handle_argvar()`.
+// Annotations which remain text (unresolved or `_NotCalled`) are rejected.
+static PyObject *resolveType(SignatureSupport &support, std::string_view thing,
+                             std::string_view funcName = {})
+{
+    thing = Signature::trimmed(thing);
+    PyObject *result{};
+    if (!funcName.empty()) {
+        AutoDecRef name(fromStringView(funcName));
+        AutoDecRef type(fromStringView(thing));
+        AutoDecRef key(PyTuple_Pack(2, name.object(), type.object()));
+        if (!key.isNull())
+            result = PyDict_GetItem(support.typeMap, key);
+    }
+    if (result == nullptr)
+        result = typeMapItem(support, thing);
+    if (result != nullptr) {
+        Py_INCREF(result);
+    } else if (thing.find('[') != std::string_view::npos) {
+        if (thing.back() != ']' || isArrayType(thing))
+            return nullptr;
+        const size_t open = thing.find('[');
+        const auto containerName = thing.substr(0, open);
+        if (containerName == "PySide6.QtGui.QGenericMatrix")
+            return nullptr;
+        AutoDecRef container(handleArgVar(support, resolveType(support, containerName)));
+        if (container.isNull() || PyUnicode_Check(container.object()))
+            return nullptr;
+        const auto parts = Signature::splitTopLevel(thing.substr(open + 1,
+                                                                 thing.size() - open - 2));
+        AutoDecRef pieces(PyTuple_New(Py_ssize_t(parts.size())));
+        for (size_t i = 0; i < parts.size(); ++i) {
+            PyObject *piece = handleArgVar(support, resolveType(support, parts.at(i)));
+            if (piece == nullptr || PyUnicode_Check(piece)) {
+                Py_XDECREF(piece);
+                return nullptr;
+            }
+            PyTuple_SetItem(pieces, Py_ssize_t(i), piece);
+        }
+        result = parts.size() == 1
+            ? PyObject_GetItem(container, PyTuple_GetItem(pieces, 0))
+            : PyObject_GetItem(container, pieces);
+        if (result == nullptr)
+            PyErr_Clear();
+    } else if (!endsWith(thing, "()")) {
+        result = evalExpression(support, thing);
+    }
+    if (result != nullptr && PyUnicode_Check(result))
+        Py_CLEAR(result);
+    return result;
+}
+
+// Resolves a signature like `calculate_props()` of `parser.py` and
+// `create_signature()` of `layout.py` into a tuple of the annotations and
+// the defaults, which belong to the last parameters.
+static PyObject *resolveSignature(SignatureSupport &support,
+                                  const Signature::ParsedSignature &signature)
+{
+    AutoDecRef annotations(PyList_New(0));
+    AutoDecRef defaults(PyList_New(0));
+    for (const auto &parameter : signature.parameters) {
+        if (isSelf(parameter))
+            continue;
+        // PYSIDE-1095: Expressions containing "->" are rewritten by the parser.
+        if (parameter.annotation.find("->") != std::string_view::npos
+            || parameter.defaultValue.find("->") != std::string_view::npos) {
+            return nullptr;
+        }
+        AutoDecRef annotation(resolveType(support, parameter.annotation, signature.funcName));
+        if (annotation.isNull() || isInstance(annotation, support.resultVariableType))
+            return nullptr;
+        // `fix_variables()`
+        if (isInstance(annotation, support.arrayLikeVariableType)) {
+            annotation.reset(handleArgVar(support, annotation.release()));
+            if (annotation.isNull())
+                return nullptr;
+        }
+        PyList_Append(annotations, annotation);
+        if (parameter.hasDefault) {
+            AutoDecRef defaultValue(resolveDefault(support,
+                                                   Signature::trimmed(parameter.defaultValue),
+                                                   Signature::trimmed(parameter.annotation)));
+            if (defaultValue.isNull())
+                return nullptr;
+            PyList_Append(defaults, defaultValue);
+        }
+    }
+    const Py_ssize_t offset = PyList_Size(annotations) - PyList_Size(defaults);
+    if (offset < 0)
+        return nullptr;
+    for (Py_ssize_t i = 0, size = PyList_Size(defaults); i < size; ++i) {
+        if (PyList_GetItem(defaults, i) != Py_None)
+            continue;
+        PyObject *optional = PyObject_GetItem(support.typingOptional,
+                                              PyList_GetItem(annotations, offset + i));
+        if (optional == nullptr) {
+            PyErr_Clear();
+            return nullptr;
+        }
+        PyList_SetItem(annotations, offset + i, optional);
+    }
+    return PyTuple_Pack(2, annotations.object(), defaults.object());
+}
+
+static Match toMatch(int result)
+{
+    if (result < 0) {
+        PyErr_Clear();
+        return Match::Unknown;
+    }
+    return result != 0 ? Match::Yes : Match::No;
+}
+
+// Corresponds to `qt_isinstance()` of `errorhandler.py`
+static Match qtIsInstance(SignatureSupport &support, PyObject *inst, PyObject *type)
+{
+    const int isFloat = PyObject_RichCompareBool(type, reinterpret_cast<PyObject *>(&PyFloat_Type), Py_EQ);
+    if (isFloat != 0) // Qt thinks differently about int and float
+        return isFloat < 0 ? toMatch(isFloat) : toMatch(PyLong_Check(inst) || PyFloat_Check(inst));
+    AutoDecRef module(PyObject_GetAttr(type, PyMagicName::module()));
+    if (module.isNull())
+        return toMatch(-1);
+    if (PyUnicode_Check(module.object())
+        && PyUnicode_CompareWithASCIIString(module.object(), "typing") == 0) {
+        if (type == support.typingAny.object())
+            return Match::Yes;
+        AutoDecRef origin(PyObject_GetAttrString(type, "__origin__"));
+        if (origin.isNull())
+            return toMatch(-1);
+        const bool isUnion = origin == support.typingUnion.object();
+        const bool isSequence = origin == support.abcSequence.object()
+            || origin == support.abcIterable.object();
+        AutoDecRef args(isUnion || isSequence ? PyObject_GetAttrString(type, "__args__") : nullptr);
+        if ((isUnion || isSequence) && (args.isNull() || !PyTuple_Check(args.object())))
+            return toMatch(-1);
+        if (isUnion) {
+            for (Py_ssize_t i = 0, size = PyTuple_Size(args); i < size; ++i) {
+                const Match m = qtIsInstance(support, inst, PyTuple_GetItem(args, i));
+                if (m != Match::No)
+                    return m;
+            }
+            return Match::No;
+        }
+        if (isSequence) {
+            // Iterating arbitrary objects may have side effects, leave that to Python.
+            if (inst == Py_None || PyLong_Check(inst) || PyFloat_Check(inst))
+                return Match::No;
+            if (!PyList_Check(inst) && !PyTuple_Check(inst))
+                return Match::Unknown;
+            AutoDecRef items(PySequence_Tuple(inst));
+            if (items.isNull() || PyTuple_Size(args) == 0)
+                return toMatch(-1);
+            for (Py_ssize_t i = 0, size = PyTuple_Size(items); i < size; ++i) {
+                const Match m = qtIsInstance(support, PyTuple_GetItem(items, i),
+                                             PyTuple_GetItem(args, 0));
+                if (m != Match::Yes)
+                    return m;
+            }
+            return Match::Yes;
+        }
+    }
+    return toMatch(PyObject_IsInstance(inst, type));
+}
+
+// Corresponds to `matched_type()` of `errorhandler.py` for one signature
+static Match matchSignature(SignatureSupport &support, PyObject *args, PyObject *signature)
+{
+    PyObject *annotations = PyTuple_GetItem(signature, 0);
+    const Py_ssize_t argCount = PyTuple_Size(args);
+    const Py_ssize_t parameterCount = PyList_Size(annotations);
+    const Py_ssize_t requiredCount = parameterCount - PyList_Size(PyTuple_GetItem(signature, 1));
+    if (argCount > parameterCount || argCount < requiredCount)
+        return Match::No;
+    for (Py_ssize_t i = 0; i < argCount; ++i) {
+        const Match m = qtIsInstance(support, PyTuple_GetItem(args, i),
+                                     PyList_GetItem(annotations, i));
+        if (m != Match::Yes)
+            return m;
+    }
+    return Match::Yes;
+}
+
+// Format a signature like the "typeerror" layout of `layout.py`: "(int, str = None)"
+static std::optional<std::string> formatSignature(SignatureSupport &support, PyObject *signature)
+{
+    PyObject *annotations = PyTuple_GetItem(signature, 0);
+    PyObject *defaults = PyTuple_GetItem(signature, 1);
+    const Py_ssize_t size = PyList_Size(annotations);
+    const Py_ssize_t offset = size - PyList_Size(defaults);
+    std::string result = "(";
+    for (Py_ssize_t i = 0; i < size; ++i) {
+        if (i > 0)
+            result += ", ";
+        AutoDecRef annotation(PyObject_CallFunctionObjArgs(support.formatAnnotation,
+                                                           PyList_GetItem(annotations, i),
+                                                           nullptr));
+        if (annotation.isNull() || !PyUnicode_Check(annotation.object())) {
+            PyErr_Clear();
+            return std::nullopt;
+        }
+        result += String::toCString(annotation);
+        if (i >= offset) {
+            AutoDecRef defaultValue(PyObject_Repr(PyList_GetItem(defaults, i - offset)));
+            if (defaultValue.isNull()) {
+                PyErr_Clear();
+                return std::nullopt;
+            }
+            result += " = ";
+            result += String::toCString(defaultValue);
+        }
+    }
+    result += ')';
+    return result;
+}
+
+static Signature::SignatureTablePtr
+    findSignatureTable(std::string_view funcName, PyObject **obtypeMod)
+{
+    // Constructors are registered by the class name itself.
+    if (auto result = Signature::findSignatureTable(funcName, obtypeMod))
+        return result;
+    const size_t dot = funcName.rfind('.');
+    if (dot == std::string_view::npos)
+        return {};
+    return Signature::findSignatureTable(funcName.substr(0, dot), obtypeMod);
+}
+
+static PyObject *formatInfoMessage(const char *funcName, PyObject *info, PyObject **errorType)
+{
+    *errorType = PyExc_TypeError;
+    if (PyDict_Check(info)) {
+        *errorType = PyExc_AttributeError;
+        PyObject *key{};
+        PyObject *value{};
+        Py_ssize_t pos = 0;
+        PyDict_Next(info, &pos, &key, &value);
+        return String::fromFormat("%s(): unsupported keyword '%U'", funcName, key);
+    }
+    const char *text = String::toCString(info);
+    if (std::strcmp(text, "<") == 0)
+        return String::fromFormat("%s(): not enough arguments", funcName);
+    if (std::strcmp(text, "0") == 0) {
+        return String::fromFormat("%s(): not enough arguments. "
+                                  "Note: keyword arguments are only supported for "
+                                  "optional parameters.", funcName);
+    }
+    if (std::strcmp(text, ">") == 0)
+        return String::fromFormat("%s(): too many arguments", funcName);
+    bool isAlnum = *text != '\0';
+    for (const char *p = text; *p != '\0' && isAlnum; ++p)
+        isAlnum = std::isalnum(static_cast<unsigned char>(*p)) != 0;
+    if (isAlnum)
+        return String::fromFormat("%s(): got multiple values for keyword argument '%s'",
+                                  funcName, text);
+    *errorType = PyExc_AttributeError;
+    return String::fromFormat("%s(): %s", funcName, text);
+}
+
+extern "C" {
+
+bool SetError_Argument_Native(PyObject *args, const char *func_name, PyObject *info)
+{
+    if (args == nullptr || Shiboken::pyVerbose() > 0)
+        return false;
+    const std::string_view funcName(func_name);
+    PyObject *obtypeMod{};
+    const auto table = findSignatureTable(funcName, &obtypeMod);
+    if (!table)
+        return false;
+    // PYSIDE-1019: Features modify the names, leave that to Python.
+    if (PyType_Check(obtypeMod)
+        && currentSelectId(reinterpret_cast<PyTypeObject *>(obtypeMod)) != 0) {
+        return false;
+    }
+
+    if (info != nullptr && info != Py_None) {
+        if (!PyDict_Check(info) && !String::check(info))
+            return false;
+        PyObject *errorType{};
+        AutoDecRef message(formatInfoMessage(func_name, info, &errorType));
+        if (message.isNull())
+            return false;
+        PyErr_SetObject(errorType, message);
+        return true;
+    }
+
+    std::vector<const Signature::ParsedSignature *> parsedSignatures;
+    for (const auto &parsed : *table) {
+        if (parsed.funcName == funcName) {
+            for (const auto &parameter : parsed.parameters) {
+                if (parameter.annotation == "...")
+                    return false;
+            }
+            parsedSignatures.push_back(&parsed);
+        }
+    }
+    // The overloads of the table are sorted and free of duplicates
+    // (`fixup_multilines()` of `parser.py`).
+    if (parsedSignatures.empty())
+        return false;
+
+    SignatureSupport support;
+    if (!support.init())
+        return false;
+    AutoDecRef signatures(PyList_New(0));
+    for (const auto *parsed : parsedSignatures) {
+        AutoDecRef signature(resolveSignature(support, *parsed));
+        if (signature.isNull())
+            return false;
+        PyList_Append(signatures, signature);
+    }
+
+    AutoDecRef argTuple(PyTuple_Check(args) ? args : PyTuple_Pack(1, args));
+    if (PyTuple_Check(args))
+        Py_INCREF(args);
+
+    PyObject *found{};
+    for (Py_ssize_t i = 0, size = PyList_Size(signatures); i < size && found == nullptr; ++i) {
+        PyObject *signature = PyList_GetItem(signatures, i);
+        const Match m = matchSignature(support, argTuple, signature);
+        if (m == Match::Unknown)
+            return false;
+        if (m == Match::Yes)
+            found = signature;
+    }
+
+    AutoDecRef pyFuncName(String::fromCString(func_name));
+    AutoDecRef funcNameRepr(PyObject_Repr(pyFuncName));
+    if (funcNameRepr.isNull())
+        return false;
+    std::string message = String::toCString(funcNameRepr);
+    if (found != nullptr) {
+        AutoDecRef argsRepr(PyObject_Repr(argTuple));
+        if (argsRepr.isNull())
+            return false;
+        message += " called with wrong argument values:\n  ";
+        message += func_name;
+        message += String::toCString(argsRepr);
+        const auto signature = formatSignature(support, found);
+        if (!signature.has_value())
+            return false;
+        message += "\nFound signature:\n  ";
+        message += func_name;
+        message += signature.value();
+        PyErr_SetString(PyExc_ValueError, message.c_str());
+        return true;
+    }
+
+    message += " called with wrong argument types:\n  ";
+    message += func_name;
+    message += '(';
+    for (Py_ssize_t i = 0, size = PyTuple_Size(argTuple); i < size; ++i) {
+        if (i > 0)
+            message += ", ";
+        auto *argType = reinterpret_cast<PyObject *>(Py_TYPE(PyTuple_GET_ITEM(argTuple.object(), i)));
+        AutoDecRef typeName(PyObject_GetAttr(argType, PyMagicName::name()));
+        if (typeName.isNull())
+            return false;
+        message += String::toCString(typeName);
+    }
+    message += ")\nSupported signatures:";
+    for (Py_ssize_t i = 0, size = PyList_Size(signatures); i < size; ++i) {
+        const auto signature = formatSignature(support, PyList_GetItem(signatures, i));
+        if (!signature.has_value())
+            return false;
+        message += "\n  ";
+        message += func_name;
+        message += signature.value();
+    }
+    PyErr_SetString(PyExc_TypeError, message.c_str());
+    return true;
+}
+
+} // extern "C"
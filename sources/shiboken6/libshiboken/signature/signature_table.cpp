@@ -0,0 +1,410 @@
+// Copyright (C) 2023 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+////////////////////////////////////////////////////////////////////////////
+//
+// signature_table.cpp
+// -------------------
+//
+// The generated modules register their signatures as a table split into
+// function names, parameter names, annotations and defaults (SbkSignature),
+// with the overloads already sorted and merged by the generator.
+// Hand-written types and older modules register signature strings, which
+// are tokenized here instead. Either way, the table is built once per type
+// or module on first use.
+//
+// It is used directly by the native error handler. `PySide_BuildSignatureProps`
+// hands the split signatures of a generated table to `parser.py`, which then
+// does not parse any text. For signature strings, `parse_signature_line`
+// replaces the regex based splitting. The annotations and defaults remain
+// strings: resolving them into Python types and creating the
+// `inspect.Signature` objects is done by `parser.py`.
+//
+// The registry is accessed under a mutex; the tables are immutable once
+// created and handed out as shared pointers.
+//
+
+#include "signature_p.h"
+
+#include "autodecref.h"
+#include "sbkstring.h"
+
+#include <algorithm>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+using namespace Shiboken;
+
+namespace {
+
+struct TableEntry
+{
+    PyObject *obtypeMod = nullptr; // borrowed, type or module
+    const char **signatures = nullptr; // Signature strings or
+    const SbkSignature *entries = nullptr; // table written by the generator
+    // Parsed on first use; shared with the callers so that a re-registration
+    // does not invalidate a table in use.
+    Signature::SignatureTablePtr table;
+};
+
+using SignatureRegistry = std::unordered_map<std::string, TableEntry>;
+
+// The registry is guarded by a mutex since the tables are created lazily,
+// possibly from several threads on free-threaded Python builds.
+std::mutex signatureRegistryMutex;
+
+SignatureRegistry &signatureRegistry()
+{
+    static SignatureRegistry result;
+    return result;
+}
+
+std::string registryKey(PyObject *type_key)
+{
+    std::string result;
+    if (PyTuple_Check(type_key) && PyTuple_Size(type_key) == 2) {
+        result = Shiboken::String::toCString(PyTuple_GET_ITEM(type_key, 0));
+        result += '.';
+        result += Shiboken::String::toCString(PyTuple_GET_ITEM(type_key, 1));
+    } else if (Shiboken::String::check(type_key)) {
+        result = Shiboken::String::toCString(type_key);
+    }
+    return result;
+}
+
+} // namespace
+
+namespace Shiboken::Signature {
+
+std::string_view trimmed(std::string_view s)
+{
+    while (!s.empty() && s.front() == ' ')
+        s.remove_prefix(1);
+    while (!s.empty() && s.back() == ' ')
+        s.remove_suffix(1);
+    return s;
+}
+
+// Find a character outside of brackets and quotes.
+size_t findTopLevel(std::string_view s, char c)
+{
+    int depth = 0;
+    char quote = 0;
+    for (size_t i = 0; i < s.size(); ++i) {
+        const char ch = s[i];
+        if (quote != 0) {
+            if (ch == quote)
+                quote = 0;
+            continue;
+        }
+        switch (ch) {
+        case '\'':
+        case '"':
+            quote = ch;
+            break;
+        case '(':
+        case '[':
+        case '{':
+            ++depth;
+            break;
+        case ')':
+        case ']':
+        case '}':
+            if (depth == 0 && ch == c)
+                return i;
+            --depth;
+            break;
+        default:
+            if (ch == c && depth == 0)
+                return i;
+            break;
+        }
+    }
+    return std::string_view::npos;
+}
+
+std::vector<std::string_view> splitTopLevel(std::string_view s)
+{
+    std::vector<std::string_view> result;
+    while (!s.empty()) {
+        const size_t pos = findTopLevel(s, ',');
+        result.push_back(trimmed(s.substr(0, pos)));
+        if (pos == std::string_view::npos)
+            break;
+        s.remove_prefix(pos + 1);
+    }
+    return result;
+}
+
+// Parse "[n:]PySide6.QtCore.QObject.setObjectName(self,name:str)->None".
+// The rules follow `_parse_line()` of `parser.py`.
+bool parseSignatureLine(std::string_view line, ParsedSignature *result)
+{
+    line = trimmed(line);
+    const size_t open = line.find('(');
+    if (open == std::string_view::npos)
+        return false;
+    const size_t colon = line.find(':');
+    if (colon < open) {
+        result->multi = 0;
+        for (char c : line.substr(0, colon)) {
+            if (c < '0' || c > '9')
+                return false;
+            result->multi = 10 * result->multi + (c - '0');
+        }
+        result->text = line.substr(colon + 1);
+        result->funcName = line.substr(colon + 1, open - colon - 1);
+    } else {
+        result->text = line;
+        result->funcName = line.substr(0, open);
+    }
+    auto rest = line.substr(open + 1);
+    const size_t close = findTopLevel(rest, ')');
+    if (close == std::string_view::npos)
+        return false;
+    auto returnPart = rest.substr(close + 1);
+    if (!returnPart.empty()) {
+        if (returnPart.compare(0, 2, "->") != 0)
+            return false;
+        result->returnType = returnPart.substr(2);
+        result->hasReturnType = true;
+    }
+    const auto arguments = splitTopLevel(rest.substr(0, close));
+    for (size_t idx = 0; idx < arguments.size(); ++idx) {
+        const auto argument = arguments.at(idx);
+        if (argument.empty())
+            continue;
+        Parameter parameter;
+        const size_t typePos = argument.find(':');
+        if (typePos == std::string_view::npos) {
+            if (idx != 0 || (argument != "self" && argument != "cls"))
+                return false;
+            parameter.name = parameter.annotation = argument;
+            result->parameters.push_back(parameter);
+            continue;
+        }
+        parameter.name = argument.substr(0, typePos);
+        auto annotation = argument.substr(typePos + 1);
+        if (annotation.find(':') != std::string_view::npos)
+            return false;
+        const size_t defaultPos = annotation.find('=');
+        if (defaultPos != std::string_view::npos) {
+            parameter.defaultValue = annotation.substr(defaultPos + 1);
+            parameter.hasDefault = true;
+            annotation = annotation.substr(0, defaultPos);
+        }
+        parameter.annotation = annotation;
+        result->parameters.push_back(parameter);
+    }
+    return true;
+}
+
+static ParsedSignature fromTableEntry(const SbkSignature &entry)
+{
+    ParsedSignature result;
+    result.multi = entry.multi;
+    result.funcName = entry.funcName;
+    result.parameters.reserve(size_t(entry.parameterCount));
+    for (int i = 0; i < entry.parameterCount; ++i) {
+        const auto &p = entry.parameters[i];
+        Parameter parameter;
+        parameter.name = p.name;
+        parameter.annotation = p.annotation;
+        if (p.defaultValue != nullptr) {
+            parameter.defaultValue = p.defaultValue;
+            parameter.hasDefault = true;
+        }
+        result.parameters.push_back(parameter);
+    }
+    if (entry.returnType != nullptr) {
+        result.returnType = entry.returnType;
+        result.hasReturnType = true;
+    }
+    return result;
+}
+
+// Corresponds to `fixup_multilines()` of `parser.py`, which the generator
+// applies to its tables: The overloads can collapse when distinctions
+// between C++ types vanish in Python. Sort them, remove the duplicates
+// and renumber them.
+static void fixupMultiLines(std::vector<ParsedSignature> *table)
+{
+    const auto byText = [](const ParsedSignature &s1, const ParsedSignature &s2) {
+        return s1.text < s2.text;
+    };
+    const auto sameText = [](const ParsedSignature &s1, const ParsedSignature &s2) {
+        return s1.text == s2.text;
+    };
+    for (auto it = table->begin(); it != table->end(); ++it) {
+        if (it->multi < 0)
+            continue;
+        auto last = std::find_if(it, table->end(),
+                                 [](const ParsedSignature &s) { return s.multi == 0; });
+        auto end = last != table->end() ? last + 1 : last;
+        std::sort(it, end, byText);
+        end = table->erase(std::unique(it, end, sameText), end);
+        const auto count = int(end - it);
+        for (int i = 0; it + i != end; ++i)
+            it[i].multi = count > 1 ? count - i - 1 : -1;
+        it = end - 1;
+    }
+}
+
+SignatureTablePtr findSignatureTable(std::string_view key, PyObject **obtypeMod)
+{
+    std::lock_guard<std::mutex> lock(signatureRegistryMutex);
+    auto &registry = signatureRegistry();
+    auto it = registry.find(std::string(key));
+    if (it == registry.end())
+        return {};
+    auto &entry = it->second;
+    if (!entry.table) {
+        auto table = std::make_shared<std::vector<ParsedSignature>>();
+        if (entry.entries != nullptr) {
+            for (const SbkSignature *e = entry.entries; e->funcName != nullptr; ++e)
+                table->push_back(fromTableEntry(*e));
+        } else {
+            for (const char **s = entry.signatures; *s != nullptr; ++s) {
+                ParsedSignature signature;
+                if (parseSignatureLine(*s, &signature))
+                    table->push_back(signature);
+            }
+            fixupMultiLines(table.get());
+        }
+        entry.table = table;
+    }
+    if (obtypeMod != nullptr)
+        *obtypeMod = entry.obtypeMod;
+    return entry.table;
+}
+
+} // namespace Shiboken::Signature
+
+// PYSIDE-1095: Arbitrary default expressions may contain "->".
+static PyObject *derefString(std::string_view s)
+{
+    std::string result(s);
+    for (size_t pos = result.find("->"); pos != std::string::npos;
+         pos = result.find("->", pos + 7)) {
+        result.replace(pos, 2, ".deref.");
+    }
+    return PyUnicode_FromStringAndSize(result.data(), Py_ssize_t(result.size()));
+}
+
+static PyObject *parameterTuple(const Signature::Parameter &parameter)
+{
+    AutoDecRef name(derefString(parameter.name));
+    AutoDecRef annotation(derefString(parameter.annotation));
+    if (!parameter.hasDefault)
+        return PyTuple_Pack(2, name.object(), annotation.object());
+    AutoDecRef defaultValue(derefString(parameter.defaultValue));
+    return PyTuple_Pack(3, name.object(), annotation.object(), defaultValue.object());
+}
+
+// Returns the same dict as `_parse_line()` in `parser.py`, apart from
+// the handling of keywords.
+static PyObject *signatureDict(const Signature::ParsedSignature &signature)
+{
+    AutoDecRef arglist(PyList_New(0));
+    if (arglist.isNull())
+        return nullptr;
+    for (const auto &parameter : signature.parameters) {
+        AutoDecRef tup(parameterTuple(parameter));
+        if (tup.isNull() || PyList_Append(arglist, tup) < 0)
+            return nullptr;
+    }
+    AutoDecRef multi(signature.multi >= 0 ? PyLong_FromLong(signature.multi)
+                                          : (Py_INCREF(Py_None), Py_None));
+    AutoDecRef funcName(PyUnicode_FromStringAndSize(signature.funcName.data(),
+                                                    Py_ssize_t(signature.funcName.size())));
+    AutoDecRef returnType(signature.hasReturnType
+                          ? PyUnicode_FromStringAndSize(signature.returnType.data(),
+                                                        Py_ssize_t(signature.returnType.size()))
+                          : (Py_INCREF(Py_None), Py_None));
+    if (multi.isNull() || funcName.isNull() || returnType.isNull())
+        return nullptr;
+    return Py_BuildValue("{sOsOsOsO}", "multi", multi.object(), "funcname", funcName.object(),
+                         "arglist", arglist.object(), "returntype", returnType.object());
+}
+
+extern "C" {
+
+void RegisterSignatureStrings(PyObject *obtype_mod, PyObject *type_key,
+                              const char *signatures[])
+{
+    const std::string key = registryKey(type_key);
+    if (key.empty())
+        return;
+    std::lock_guard<std::mutex> lock(signatureRegistryMutex);
+    auto &entry = signatureRegistry()[key];
+    entry.obtypeMod = obtype_mod;
+    if (entry.signatures != signatures || entry.entries != nullptr) {
+        entry.signatures = signatures;
+        entry.entries = nullptr;
+        entry.table.reset();
+    }
+}
+
+void RegisterSignatureTable(PyObject *obtype_mod, PyObject *type_key,
+                            const SbkSignature *signatures)
+{
+    const std::string key = registryKey(type_key);
+    if (key.empty())
+        return;
+    std::lock_guard<std::mutex> lock(signatureRegistryMutex);
+    auto &entry = signatureRegistry()[key];
+    entry.obtypeMod = obtype_mod;
+    if (entry.entries != signatures || entry.signatures != nullptr) {
+        entry.signatures = nullptr;
+        entry.entries = signatures;
+        entry.table.reset();
+    }
+}
+
+PyObject *SignatureTableAsList(PyObject *type_key)
+{
+    /*
+     * Returns a list of the dicts of `signatureDict()` for a table written
+     * by the generator, to be passed to `pyside_type_init()` instead of the
+     * signature strings. Returns nullptr without error for signature strings.
+     */
+    const std::string key = registryKey(type_key);
+    {
+        std::lock_guard<std::mutex> lock(signatureRegistryMutex);
+        auto &registry = signatureRegistry();
+        auto it = registry.find(key);
+        if (it == registry.end() || it->second.entries == nullptr)
+            return nullptr;
+    }
+    const auto table = Signature::findSignatureTable(key, nullptr);
+    if (!table)
+        return nullptr;
+    AutoDecRef result(PyList_New(0));
+    if (result.isNull())
+        return nullptr;
+    for (const auto &signature : *table) {
+        AutoDecRef dict(signatureDict(signature));
+        if (dict.isNull() || PyList_Append(result, dict) < 0)
+            return nullptr;
+    }
+    return result.release();
+}
+
+PyObject *parse_signature_line(PyObject * /* self */, PyObject *line)
+{
+    /*
+     * Returns the same dict as `_parse_line()` in `parser.py`, apart from
+     * the handling of keywords, or None if the line is not understood.
+     */
+    const char *text = String::toCString(line);
+    if (text == nullptr)
+        return nullptr;
+    Signature::ParsedSignature signature;
+    if (!Signature::parseSignatureLine(text, &signature))
+        Py_RETURN_NONE;
+    return signatureDict(signature);
+}
+
+} // extern "C"
@@ -6,6 +6,10 @@
 
 #include "signature.h"
 
+#include <memory>
+#include <string_view>
+#include <vector>
+
 extern "C" {
 
 // signature_globals.cpp
@@ -65,6 +69,17 @@ PyObject *_get_class_of_descr(PyObject *ob);
 PyObject *_address_to_stringlist(PyObject *numkey);
 int _finish_nested_classes(PyObject *dict);
 
+// signature_table.cpp
+void RegisterSignatureStrings(PyObject *obtype_mod, PyObject *type_key,
+                              const char *signatures[]);
+void RegisterSignatureTable(PyObject *obtype_mod, PyObject *type_key,
+                            const SbkSignature *signatures);
+PyObject *SignatureTableAsList(PyObject *type_key);
+PyObject *parse_signature_line(PyObject *self, PyObject *line);
+
+// signature_errorhandler.cpp
+bool SetError_Argument_Native(PyObject *args, const char *func_name, PyObject *info);
+
 #ifdef PYPY_VERSION
 // PyPy has a special builtin method.
 PyObject *GetSignature_Method(PyObject *, PyObject *);
@@ -74,4 +89,40 @@ PyObject *_get_class_of_bm(PyObject *ob_cf);
 
 } // extern "C"
 
+// signature_table.cpp
+
+namespace Shiboken::Signature {
+
+struct Parameter
+{
+    std::string_view name;
+    std::string_view annotation;
+    std::string_view defaultValue;
+    bool hasDefault = false;
+};
+
+// One signature split into its parts, either from the table written by the
+// generator or from a line of the signature strings. The annotations and
+// defaults are unresolved text.
+struct ParsedSignature
+{
+    int multi = -1;
+    std::string_view text; // The line without the multi prefix (strings only)
+    std::string_view funcName;
+    std::vector<Parameter> parameters; // Including self/cls
+    std::string_view returnType;
+    bool hasReturnType = false;
+};
+
+std::string_view trimmed(std::string_view s);
+size_t findTopLevel(std::string_view s, char c);
+std::vector<std::string_view> splitTopLevel(std::string_view s);
+bool parseSignatureLine(std::string_view line, ParsedSignature *result);
+using SignatureTablePtr = std::shared_ptr<const std::vector<ParsedSignature>>;
+
+// Returns the parsed signatures registered for a type or module key
+SignatureTablePtr findSignatureTable(std::string_view key, PyObject **obtypeMod);
+
+} // namespace Shiboken::Signature
+
 #endif // SIGNATURE_IMPL_H
@@ -22,6 +22,7 @@ class VoidPtr(object): ...
 
 
 def _unpickle_enum(arg__1: object, arg__2: object) -> object: ...
+def callProfile() -> list[dict[str, object]]: ...
 def createdByPython(arg__1: Shiboken.Object) -> bool: ...
 def delete(arg__1: Shiboken.Object) -> None: ...
 def dump(arg__1: object) -> str: ...
@@ -30,6 +31,8 @@ def getCppPointer(arg__1: Shiboken.Object) -> tuple[int, ...]: ...
 def invalidate(arg__1: Shiboken.Object) -> None: ...
 def isValid(arg__1: object) -> bool: ...
 def ownedByPython(arg__1: Shiboken.Object) -> bool: ...
+def resetCallProfile() -> None: ...
+def setCallProfilingEnabled(arg__1: bool) -> None: ...
 def wrapInstance(arg__1: int, arg__2: type) -> Shiboken.Object: ...
 
 
@@ -18,6 +18,11 @@ from shibokensupport.signature.mapping import (type_map, update_mapping,
 from shibokensupport.signature.lib.tool import build_brace_pattern
 from shibokensupport import feature
 
+try:
+    from signature_bootstrap import parse_signature_line as _parse_line_native
+except ImportError:
+    _parse_line_native = None
+
 _DEBUG = False
 LIST_KEYWORDS = False
 
@@ -121,7 +126,7 @@ def _parse_arglist(argstr):
     return [x.strip() for x in split(argstr) if x.strip() not in ("", ",")]
 
 
-def _parse_line(line):
+def _parse_line_python(line):
     line_re = r"""
         ((?P<multi> ([0-9]+)) : )?    # the optional multi-index
         (?P<funcname> \w+(\.\w+)*)    # the function name
@@ -145,10 +150,6 @@ def _parse_line(line):
             # This should never happen again (but who knows?)
             raise SystemError(f'Invalid argument "{arg}" in "{line}".')
         name, ann = tokens
-        if name in keyword.kwlist:
-            if LIST_KEYWORDS:
-                print("KEYWORD", ret)
-            name = name + "_"
         if "=" in ann:
             ann, default = ann.split("=", 1)
             tup = name, ann, default
@@ -159,11 +160,44 @@ def _parse_line(line):
     multi = ret.multi
     if multi is not None:
         ret.multi = int(multi)
+    return ret
+
+
+def _fix_keywords(ret):
+    args = []
+    for tup in ret.arglist:
+        name = tup[0]
+        if name in keyword.kwlist:
+            if LIST_KEYWORDS:
+                print("KEYWORD", ret)
+            tup = (name + "_",) + tup[1:]
+        args.append(tup)
+    ret.arglist = args
     funcname = ret.funcname
     parts = funcname.split(".")
     if parts[-1] in keyword.kwlist:
         ret.funcname = funcname + "_"
-    return vars(ret)
+    return ret
+
+
+def _parse_line(line):
+    # The signature strings are split natively by libshiboken, which also
+    # uses them for the error messages. The regex version stays as fallback.
+    # The annotations and defaults are still text, resolved by calculate_props().
+    parsed = _parse_line_native(line) if _parse_line_native else None
+    ret = SimpleNamespace(**parsed) if parsed else _parse_line_python(line)
+    return vars(_fix_keywords(ret))
+
+
+def _signature_text(parsed):
+    # The text form of a signature passed already split, for the messages.
+    args = []
+    for arg in parsed.arglist:
+        name, ann = arg[:2]
+        text = name if name == ann else f"{name}:{ann}"
+        args.append(text if len(arg) == 2 else f"{text}={arg[2]}")
+    text = f"{parsed.funcname}({','.join(args)})"
+    return text if parsed.returntype is None else f"{text}->{parsed.returntype}"
 
 
 def _using_snake_case():
@@ -313,6 +347,8 @@ def handle_matrix(arg):
     return eval(result, globals(), namespace)
 
 
+_container_cache = {}
+
 def _resolve_type(thing, line, level, var_handler, func_name=None):
     # manual set of 'str' instead of 'bytes'
     if func_name:
@@ -327,6 +363,10 @@ def _resolve_type(thing, line, level, var_handler, func_name=None):
 
     # Now the nested structures are handled.
     if "[" in thing:
+        # The same containers show up in many signatures, evaluate them once.
+        cache_key = thing, var_handler
+        if cache_key in _container_cache:
+            return _container_cache[cache_key]
         # handle primitive arrays
         if re.search(r"\[\d*\]$", thing):
             thing = _resolve_arraytype(thing, line)
@@ -350,7 +390,9 @@ def _resolve_type(thing, line, level, var_handler, func_name=None):
         result = f"{contr}[{thing}]"
         # PYSIDE-1538: Make sure that the eval does not crash.
         try:
-            return eval(result, globals(), namespace)
+            ret = eval(result, globals(), namespace)
+            _container_cache[cache_key] = ret
+            return ret
         except Exception as e:
             warnings.warn(f"""pyside_type_init:_resolve_type
 
@@ -401,7 +443,12 @@ def handle_retvar(obj):
 
 
 def calculate_props(line):
-    parsed = SimpleNamespace(**_parse_line(line.strip()))
+    if isinstance(line, dict):
+        # Split by the generator (SbkSignature tables of libshiboken)
+        parsed = _fix_keywords(SimpleNamespace(**line))
+        line = _signature_text(parsed)
+    else:
+        parsed = SimpleNamespace(**_parse_line(line.strip()))
     arglist = parsed.arglist
     annotations = {}
     _defaults = []
@@ -526,7 +573,12 @@ def pyside_type_init(type_key, sig_strings):
     dprint()
     dprint(f"Initialization of type key '{type_key}'")
     update_mapping()
-    lines = fixup_multilines(sig_strings)
+    # The generated modules pass their signatures split into dicts, with the
+    # multilines already fixed up by the generator.
+    if sig_strings and isinstance(sig_strings[0], dict):
+        lines = sig_strings
+    else:
+        lines = fixup_multilines(sig_strings)
     ret = {}
     multi_props = []
     for line in lines:
@@ -0,0 +1,50 @@
+#!/usr/bin/env python
+# Copyright (C) 2023 The Qt Company Ltd.
+# SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only WITH Qt-GPL-exception-1.0
+
+'''Test cases for the call statistics of bindings generated with --call-profiling'''
+
+import os
+import sys
+import unittest
+
+from pathlib import Path
+sys.path.append(os.fspath(Path(__file__).resolve().parents[1]))
+from shiboken_paths import init_paths
+init_paths()
+from minimal import Obj
+from shiboken6 import Shiboken
+
+
+def find_entry(class_name, signature):
+    for entry in Shiboken.callProfile():
+        if entry["class"] == class_name and entry["signature"].startswith(signature):
+            return entry
+    return None
+
+
+class CallProfilerTest(unittest.TestCase):
+
+    def testCallCount(self):
+        Shiboken.resetCallProfile()
+        obj = Obj(1)
+        for i in range(10):
+            obj.setObjId(i)
+        entry = find_entry("Obj", "setObjId(int)")
+        self.assertTrue(entry)
+        self.assertEqual(entry["calls"], 10)
+        self.assertFalse(entry["allow_thread"])
+        self.assertGreaterEqual(entry["cpp_time"], 0.0)
+        self.assertGreaterEqual(entry["gil_time"], 0.0)
+
+        Shiboken.setCallProfilingEnabled(False)
+        obj.setObjId(42)
+        Shiboken.setCallProfilingEnabled(True)
+        self.assertEqual(find_entry("Obj", "setObjId(int)")["calls"], 10)
+
+        Shiboken.resetCallProfile()
+        self.assertIsNone(find_entry("Obj", "setObjId(int)"))
+
+
+if __name__ == '__main__':
+    unittest.main()
@@ -0,0 +1,39 @@
+#!/usr/bin/env python
+# Copyright (C) 2023 The Qt Company Ltd.
+# SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only WITH Qt-GPL-exception-1.0
+
+'''Test importing a module again after removing it from sys.modules
+   (multi-phase initialization creates a new module object).'''
+
+import importlib
+import os
+import sys
+import unittest
+
+from pathlib import Path
+sys.path.append(os.fspath(Path(__file__).resolve().parents[1]))
+from shiboken_paths import init_paths
+init_paths()
+
+from sample import Event
+
+
+class TestModuleReimport(unittest.TestCase):
+
+    def testReimport(self):
+        old_module = importlib.import_module('other')
+        del sys.modules['other']
+        new_module = importlib.import_module('other')
+        self.assertIsNot(new_module, old_module)
+        self.assertEqual(new_module.__spec__.name, 'other')
+        # The wrapper types are created only once and shared.
+        self.assertIs(new_module.OtherDerived, old_module.OtherDerived)
+        # Conversions of types from the required module still work.
+        obj = new_module.OtherDerived()
+        event = Event(Event.ANY_EVENT)
+        self.assertEqual(obj.useValueTypeFromOtherModule(event).eventType(),
+                         Event.ANY_EVENT)
+
+
+if __name__ == '__main__':
+    unittest.main()
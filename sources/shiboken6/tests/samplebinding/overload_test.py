@@ -13,6 +13,7 @@ sys.path.append(os.fspath(Path(__file__).resolve().parents[1]))
 from shiboken_paths import init_paths
 init_paths()
 from sample import Echo, Overload, Point, PointF, Polygon, Rect, RectF, Size, Str
+from shibokensupport.signature.errorhandler import seterror_argument
 
 
 def raisesWithErrorMessage(func, arguments, errorType, errorMsg):
@@ -137,6 +138,28 @@ class OverloadTest(unittest.TestCase):
                                         TypeError, 'called with wrong argument types:')
         self.assertTrue(result)
 
+    def assertErrorMessageParity(self, func, func_name, args):
+        '''Check that the error message created natively is the same as the
+           one created by the Python errorhandler.'''
+        with self.assertRaises((TypeError, ValueError)) as cm:
+            func(*args)
+        err_type, msg = seterror_argument(args, func_name, None)
+        self.assertEqual(type(cm.exception), err_type)
+        self.assertEqual(str(cm.exception), msg)
+
+    def testErrorMessageParity(self):
+        overload = Overload()
+        cases = (("drawText3", (Str(), Str(), Str(), 4, 5)),
+                 ("drawText4", ('a', 'b', 'c')),
+                 ("drawText2", (1.5, 'b')),  # Defaults Echo(), 0, Str()
+                 ("strBufferOverloads", (1, 2)),  # Default nullptr
+                 ("acceptSequence", (1.5, 'b')),  # Default enum value
+                 ("differentReturnTypes", ('a',)))
+        for name, args in cases:
+            with self.subTest(name=name):
+                self.assertErrorMessageParity(getattr(overload, name),
+                                              f"sample.Overload.{name}", args)
+
     def testDrawText4(self):
         overload = Overload()
         self.assertEqual(overload.drawText4(1, 2, 3), Overload.Function0)
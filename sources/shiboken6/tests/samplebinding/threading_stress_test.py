@@ -0,0 +1,110 @@
+#!/usr/bin/env python
+# Copyright (C) 2023 The Qt Company Ltd.
+# SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only WITH Qt-GPL-exception-1.0
+
+'''Stress tests running bindings from many threads concurrently.
+
+They are mainly meant for free-threaded Python builds, where the threads
+execute in parallel, but also run with the GIL.'''
+
+import os
+import sys
+import threading
+import unittest
+
+from pathlib import Path
+sys.path.append(os.fspath(Path(__file__).resolve().parents[1]))
+from shiboken_paths import init_paths
+init_paths()
+
+from sample import ObjectModel, ObjectType, ObjectView, Point
+from shiboken6 import Shiboken
+
+
+THREAD_COUNT = max(8, os.cpu_count() or 1)
+ITERATIONS = 200
+
+
+def run_in_threads(function, *args):
+    '''Run function(index, *args) in THREAD_COUNT threads started at the same
+       time and re-raise the first exception.'''
+    barrier = threading.Barrier(THREAD_COUNT)
+    errors = []
+
+    def worker(index):
+        barrier.wait()
+        try:
+            function(index, *args)
+        except Exception as e:
+            errors.append(e)
+
+    threads = [threading.Thread(target=worker, args=(i,)) for i in range(THREAD_COUNT)]
+    for thread in threads:
+        thread.start()
+    for thread in threads:
+        thread.join()
+    if errors:
+        raise errors[0]
+
+
+class ThreadingStressTest(unittest.TestCase):
+    '''Exercise the global state of libshiboken (wrapper map, converters,
+       parent/child relationships, references) from many threads.'''
+
+    def testParentChild(self):
+        def work(index):
+            parents = [ObjectType() for i in range(3)]
+            for i in range(ITERATIONS):
+                children = [ObjectType() for c in range(5)]
+                for c, child in enumerate(children):
+                    child.setParent(parents[(i + c) % 3])
+                # Reparent and check the wrapper identity
+                for child in children:
+                    child.setParent(parents[i % 3])
+                    self.assertTrue(child.parent() is parents[i % 3])
+                if i % 10 == 0:
+                    # Deleting a parent invalidates its children
+                    victim = parents[i % 3]
+                    orphans = list(victim.children())
+                    Shiboken.delete(victim)
+                    for orphan in orphans:
+                        self.assertFalse(Shiboken.isValid(orphan))
+                    parents[i % 3] = ObjectType()
+            for parent in parents:
+                for child in parent.children():
+                    self.assertTrue(child.parent() is parent)
+
+        run_in_threads(work)
+
+    def testKeepReferenceSharedModel(self):
+        models = [ObjectModel() for i in range(4)]
+
+        def work(index):
+            views = [ObjectView() for i in range(4)]
+            for i in range(ITERATIONS):
+                for v, view in enumerate(views):
+                    view.setModel(models[(i + v + index) % 4])
+                    self.assertTrue(view.model() in models)
+            for view in views:
+                view.setModel(None)
+
+        if hasattr(sys, "getrefcount"):
+            refcounts = [sys.getrefcount(m) for m in models]
+        run_in_threads(work)
+        if hasattr(sys, "getrefcount"):
+            self.assertEqual([sys.getrefcount(m) for m in models], refcounts)
+
+    def testValueTypes(self):
+        def work(index):
+            total = Point(0, 0)
+            for i in range(ITERATIONS):
+                total = total + Point(i, index)
+            expected = ITERATIONS * (ITERATIONS - 1) / 2
+            self.assertEqual(total.x(), expected)
+            self.assertEqual(total.y(), ITERATIONS * index)
+
+        run_in_threads(work)
+
+
+if __name__ == '__main__':
+    unittest.main()
@@ -0,0 +1,78 @@
+// Copyright (C) 2026 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only WITH Qt-GPL-exception-1.0
+
+#include "unitybatchestest.h"
+#include "unitybatches.h"
+
+#include <QtTest/QTest>
+
+using namespace Qt::StringLiterals;
+
+using BatchFiles = QList<QList<qsizetype>>;
+
+static BatchFiles batchFiles(const QList<UnityBatch> &batches)
+{
+    BatchFiles result;
+    for (const auto &batch : batches)
+        result.append(batch.files);
+    return result;
+}
+
+void UnityBatchesTest::testBalance()
+{
+    // Largest first into the smallest batch, files in order of generation
+    const QList<UnityBatchFile> files{{50, {}, {}}, {30, {}, {}}, {20, {}, {}},
+                                      {20, {}, {}}, {10, {}, {}}};
+    const auto batches = distributeBatches(files, 2);
+    QCOMPARE(batchFiles(batches), BatchFiles({{0, 3}, {1, 2, 4}}));
+    QCOMPARE(batches.at(0).size, qsizetype(70));
+    QCOMPARE(batches.at(1).size, qsizetype(60));
+}
+
+void UnityBatchesTest::testEmptyBatches()
+{
+    // The requested number of batches is always returned
+    const QList<UnityBatchFile> files{{10, {}, {}}};
+    QCOMPARE(batchFiles(distributeBatches(files, 3)), BatchFiles({{0}, {}, {}}));
+    QVERIFY(distributeBatches(files, 0).isEmpty());
+}
+
+void UnityBatchesTest::testNativeCode()
+{
+    // Wrappers sharing a native code snippet go into different batches
+    const QString helper = u"static int helper() { return 0; }"_s;
+    const QList<UnityBatchFile> files{{50, {}, {helper}}, {40, {}, {}},
+                                      {30, {}, {}}, {20, {}, {helper}}};
+    QList<qsizetype> conflicts;
+    const auto batches = distributeBatches(files, 2, &conflicts);
+    QCOMPARE(batchFiles(batches), BatchFiles({{0}, {1, 2, 3}}));
+    QVERIFY(conflicts.isEmpty());
+}
+
+void UnityBatchesTest::testUsingNamespace()
+{
+    // Wrappers starting with "using namespace" are only combined with
+    // wrappers using the same namespace.
+    const QList<UnityBatchFile> files{{50, u"Outer"_s, {}}, {40, {}, {}},
+                                      {30, u"Outer"_s, {}}, {20, {}, {}},
+                                      {10, {}, {}}};
+    QList<qsizetype> conflicts;
+    const auto batches = distributeBatches(files, 2, &conflicts);
+    QCOMPARE(batchFiles(batches), BatchFiles({{0, 2}, {1, 3, 4}}));
+    QCOMPARE(batches.at(0).usingNamespace, u"Outer"_s);
+    QVERIFY(batches.at(1).usingNamespace.isEmpty());
+    QVERIFY(conflicts.isEmpty());
+}
+
+void UnityBatchesTest::testConflicts()
+{
+    // Files which cannot be separated go into the smallest batch and are reported
+    const QList<UnityBatchFile> files{{50, u"Outer"_s, {}}, {40, {}, {}},
+                                      {30, u"Other"_s, {}}};
+    QList<qsizetype> conflicts;
+    const auto batches = distributeBatches(files, 2, &conflicts);
+    QCOMPARE(batchFiles(batches), BatchFiles({{0}, {1, 2}}));
+    QCOMPARE(conflicts, QList<qsizetype>({2}));
+}
+
+QTEST_APPLESS_MAIN(UnityBatchesTest)
@@ -0,0 +1,20 @@
+// Copyright (C) 2026 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only WITH Qt-GPL-exception-1.0
+
+#ifndef UNITYBATCHESTEST_H
+#define UNITYBATCHESTEST_H
+
+#include <QtCore/QObject>
+
+class UnityBatchesTest : public QObject
+{
+    Q_OBJECT
+private slots:
+    void testBalance();
+    void testEmptyBatches();
+    void testNativeCode();
+    void testUsingNamespace();
+    void testConflicts();
+};
+
+#endif // UNITYBATCHESTEST_H
@@ -0,0 +1,147 @@
+# Copyright (C) 2023 The Qt Company Ltd.
+# SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only WITH Qt-GPL-exception-1.0
+
+"""
+gil_advisor.py
+==============
+
+This script suggests ``allow-thread`` modifications for the typesystem
+based on call statistics recorded by bindings generated with the
+``--call-profiling`` option of shiboken (CMake option
+``PYSIDE_CALL_PROFILING`` of PySide).
+
+Usage:
+------
+
+Run a script under profiling and print the suggestions:
+
+    python gil_advisor.py [options] script.py [script arguments]
+
+or analyze statistics previously saved by the application:
+
+    import json
+    from shiboken6 import Shiboken
+    ...
+    with open("profile.json", "w") as f:
+        json.dump(Shiboken.callProfile(), f)
+
+    python gil_advisor.py [options] --profile profile.json
+
+Heuristics
+----------
+
+Releasing the GIL allows other Python threads to run while a function
+executes in C++, but it costs a thread state save/restore and possibly
+waiting for the GIL afterwards.
+
+* Functions keeping the GIL whose mean time in C++ exceeds the
+  ``--release-threshold`` block other threads; ``allow-thread="yes"``
+  is suggested.
+* Functions releasing the GIL whose mean time in C++ is below the
+  ``--keep-threshold`` and which spend more time on the GIL handling than
+  in C++ gain nothing from it; ``allow-thread="no"`` is suggested.
+
+Functions called less often than ``--min-calls`` are not considered.
+"""
+
+import argparse
+import json
+import runpy
+import sys
+
+from collections import defaultdict
+from xml.sax.saxutils import quoteattr
+
+
+DESC = """Suggest allow-thread typesystem modifications from call statistics
+recorded by bindings generated with --call-profiling."""
+
+
+def suggestions(entries, release_threshold, keep_threshold, min_calls):
+    """Return a dict of class name to a list of (signature, allow_thread, comment)"""
+    result = defaultdict(list)
+    for e in entries:
+        calls = e["calls"]
+        if calls < min_calls:
+            continue
+        mean_cpp = e["cpp_time"] / calls
+        mean_gil = e["gil_time"] / calls
+        comment = (f"{calls} calls, mean {mean_cpp * 1e6:.2f} us in C++, "
+                   f"{mean_gil * 1e6:.2f} us GIL handling")
+        if not e["allow_thread"] and mean_cpp >= release_threshold:
+            result[e["class"]].append((e["signature"], True, comment))
+        elif e["allow_thread"] and mean_cpp < keep_threshold and mean_gil > mean_cpp:
+            result[e["class"]].append((e["signature"], False, comment))
+    return result
+
+
+def format_suggestions(suggested):
+    lines = []
+    for class_name in sorted(suggested.keys()):
+        entries = sorted(suggested[class_name])
+        if class_name:
+            lines.append(f"<!-- Add to the type entry of {class_name} -->")
+            lines.append(f"<object-type name={quoteattr(class_name)}>")
+        for signature, allow_thread, comment in entries:
+            value = "yes" if allow_thread else "no"
+            modification = (f"<modify-function signature={quoteattr(signature)} "
+                            f"allow-thread=\"{value}\"/>")
+            if class_name:
+                lines.append(f"    <!-- {comment} -->")
+                lines.append(f"    {modification}")
+            else:  # Global function
+                lines.append(f"<!-- {comment} -->")
+                lines.append(f"<function signature={quoteattr(signature)}>")
+                lines.append(f"    {modification}")
+                lines.append("</function>")
+        if class_name:
+            lines.append("</object-type>")
+    return "\n".join(lines)
+
+
+def profile_script(argv):
+    from shiboken6 import Shiboken
+    Shiboken.resetCallProfile()
+    sys.argv = argv
+    try:
+        runpy.run_path(argv[0], run_name="__main__")
+    except SystemExit:
+        pass
+    return Shiboken.callProfile()
+
+
+if __name__ == "__main__":
+    parser = argparse.ArgumentParser(description=DESC,
+                                     formatter_class=argparse.RawTextHelpFormatter)
+    parser.add_argument("--profile", "-p", type=str,
+                        help="JSON file containing the output of Shiboken.callProfile()")
+    parser.add_argument("--release-threshold", type=float, default=50.0,
+                        help="Mean C++ time (us) above which the GIL should be released")
+    parser.add_argument("--keep-threshold", type=float, default=2.0,
+                        help="Mean C++ time (us) below which the GIL should be kept")
+    parser.add_argument("--min-calls", type=int, default=10,
+                        help="Minimum number of calls of a function to be considered")
+    parser.add_argument("script", nargs=argparse.REMAINDER,
+                        help="Script to run and its arguments")
+    options = parser.parse_args()
+
+    if options.profile:
+        with open(options.profile) as f:
+            entries = json.load(f)
+    elif options.script:
+        entries = profile_script(options.script)
+    else:
+        parser.print_help()
+        sys.exit(1)
+
+    if not entries:
+        print("No call statistics found; were the bindings generated with --call-profiling?",
+              file=sys.stderr)
+        sys.exit(1)
+
+    suggested = suggestions(entries, options.release_threshold / 1e6,
+                            options.keep_threshold / 1e6, options.min_calls)
+    if suggested:
+        print(format_suggestions(suggested))
+    else:
+        print("No modifications suggested.", file=sys.stderr)